@@ -2,28 +2,34 @@
 #ifndef AVL_TREE
 #define AVL_TREE
 
+#include <type_traits>
 #include "Comparator.h"
+#include "KeyComparator.h"
 #include "AVLTreeEnumerator.h"
 
-template <typename T>
+template <typename T, typename Compare>
 class AVLTree {
-	template <typename U>
+	template <typename U, typename C>
 	friend class AVLTreeEnumerator;
 private:
-	Comparator<T>* comparator = NULL;               // used to determine tree order and item equality
+	Compare* comparator = NULL;                     // used to determine tree order and item equality
 	unsigned long size = 0;                         // actual number of items currently in tree
 	T data{};                                       // data item of any type
 	bool empty = true;                              // flag to indicate whether node contains data
 	int diff = 0;                                   // height of right minus height of left
-	AVLTree<T>* left = NULL;                        // pointer to left subtree
-	AVLTree<T>* right = NULL;                       // pointer to right subtree
+	AVLTree<T, Compare>* left = NULL;               // pointer to left subtree
+	AVLTree<T, Compare>* right = NULL;              // pointer to right subtree
 	void zig();                                     // right rotation
 	void zag();                                     // left rotation
 	void zigzag();                                  // left rotation on left subtree, followed by right rotation
 	void zagzig();                                  // right rotation on right subtree, followed by left rotation
 	void rebalance();                               // check for and rebalance this node, if needed
+	template <typename K>
+	const AVLTree<T, Compare>* findKeyNode(const K& key) const;    // node holding an item with key, NULL if none
+	template <typename K, typename Keyed>
+	const AVLTree<T, Compare>* descendKey(const K& key, const Keyed& keyComparator) const;
 public:
-	AVLTree(Comparator<T>* comparator);             // creates empty linked tree with comparator
+	AVLTree(Compare* comparator);                   // creates empty linked tree with comparator
 	virtual ~AVLTree();                             // deletes subtrees
 
 	// if an equivalent item is not already present, insert item in order and return true
@@ -46,9 +52,21 @@ public:
 	// if an equivalent item is not present, throw a new ExceptionLinkedtreeAccess
 	T find(const T item) const;
 
+	// lookups by a key of type K instead of a whole item, Compare has to be a KeyComparator<T, K>, otherwise
+	// they throw a new ExceptionAVLTreeAccess
+	// if an item with the key is present, return true
+	// if an item with the key is not present, false
+	template <typename K>
+	bool containsKey(const K& key) const;
+
+	// if an item with the key is present, return a copy of the item
+	// if an item with the key is not present, throw a new ExceptionAVLTreeAccess
+	template <typename K>
+	T findKey(const K& key) const;
+
 	unsigned long getSize() const;                  // returns the current number of items in the tree
 
-	AVLTreeEnumerator<T> enumerator(AVLTreeOrder order = AVLTreeOrder::inorder) const;    // create an enumerator for this AVL tree
+	AVLTreeEnumerator<T, Compare> enumerator(AVLTreeOrder order = AVLTreeOrder::inorder) const;    // create an enumerator for this AVL tree
 };
 
 // Add your implementation below this line.
@@ -58,8 +76,8 @@ public:
 /*
 Constructor for a tree, takes a comparator parameter
 */
-template <typename T>
-AVLTree<T>::AVLTree(Comparator<T>* comparator) {
+template <typename T, typename Compare>
+AVLTree<T, Compare>::AVLTree(Compare* comparator) {
 	this->comparator = comparator;
 }
 
@@ -67,8 +85,8 @@ AVLTree<T>::AVLTree(Comparator<T>* comparator) {
 /*
 Destructor for a tree, deletes all the subtrees
 */
-template <typename T>
-AVLTree<T>::~AVLTree() {
+template <typename T, typename Compare>
+AVLTree<T, Compare>::~AVLTree() {
 	delete left;
 	delete right;
 	left = nullptr;
@@ -80,8 +98,8 @@ AVLTree<T>::~AVLTree() {
 Method to perform a right rotation
 NOTE: This code is copied from the document in Canvas
 */
-template <typename T>
-void AVLTree<T>::zig() {
+template <typename T, typename Compare>
+void AVLTree<T, Compare>::zig() {
 
 	if (left == NULL) {  // no left, no way to zig
 		return;
@@ -92,7 +110,7 @@ void AVLTree<T>::zig() {
 	int pdiff = left->diff;
 	
 	// modify the tree
-	AVLTree<T>* olnr = left;  
+	AVLTree<T, Compare>* olnr = left;  
 	
 	// olnr is "old left, new right"
 	left = olnr->left;
@@ -121,8 +139,8 @@ void AVLTree<T>::zig() {
 Method to perform a left rotation
 NOTE: This code is copied from the documents on Canvas
 */
-template<typename T>
-void AVLTree<T>::zag(){
+template <typename T, typename Compare>
+void AVLTree<T, Compare>::zag(){
 
 	if (right == NULL) {  // no right, no way to zig
 		return;
@@ -133,7 +151,7 @@ void AVLTree<T>::zag(){
 	int pdiff = right->diff;
 	
 	// modify the tree
-	AVLTree<T>* ornl = right;  
+	AVLTree<T, Compare>* ornl = right;  
 	
 	// ornl is "old right, new left"
 	right = ornl->right;
@@ -162,8 +180,8 @@ void AVLTree<T>::zag(){
 /*
 Method to perform a left and then a right rotation
 */
-template <typename T>
-void AVLTree<T>::zigzag() {
+template <typename T, typename Compare>
+void AVLTree<T, Compare>::zigzag() {
 
 	left->zag();
 	zig();
@@ -173,8 +191,8 @@ void AVLTree<T>::zigzag() {
 /*
 Method to perform a right rotation and then a left rotation
 */
-template <typename T>
-void AVLTree<T>::zagzig() {
+template <typename T, typename Compare>
+void AVLTree<T, Compare>::zagzig() {
 
 	right->zig();
 	zag();
@@ -185,8 +203,8 @@ void AVLTree<T>::zagzig() {
 Method to check which rotation needs to be performed
 NOTE: This code is largely taken from the code in the lecture slides
 */
-template <typename T>
-void AVLTree<T>::rebalance() {
+template <typename T, typename Compare>
+void AVLTree<T, Compare>::rebalance() {
 
 	//check if difference is within acceptable range
 	if (diff >= -1 && diff <= 1) {
@@ -218,8 +236,8 @@ void AVLTree<T>::rebalance() {
 /*
 Method to insert an item into the tree
 */
-template <typename T>
-bool AVLTree<T>::insert(T item) {
+template <typename T, typename Compare>
+bool AVLTree<T, Compare>::insert(T item) {
 
 	//if node empty, put item in node
 	if (empty) {
@@ -229,19 +247,22 @@ bool AVLTree<T>::insert(T item) {
 		return true;
 	}
 
+	//compares once, the result picks the branch below
+	int comparison = comparator->compare(item, data);
+
 	//if item already present, return false
-	else if(comparator->compare(item, data) == 0) {
+	if (comparison == 0) {
 		return false;
 	}
 
 	//if item less than node, insert in left subtree
-	else if (comparator->compare(item, data) == -1) {
+	else if (comparison == -1) {
 		
 		//check if left child exists
 		if (left == nullptr) {
 
 			//initialize left subtree
-			left = new AVLTree<T>(comparator);
+			left = new AVLTree<T, Compare>(comparator);
 
 			//insert on left subtree
 			left->data = item;
@@ -276,13 +297,13 @@ bool AVLTree<T>::insert(T item) {
 
 	}
 	//if item greater than node, insert in right subtree
-	else if (comparator->compare(item, data) == 1) {
+	else if (comparison == 1) {
 		
 		//check if right child exists
 		if (right == nullptr) {
 
 			//initialize right subtree
-			right = new AVLTree<T>(comparator);
+			right = new AVLTree<T, Compare>(comparator);
 
 			//insert on right subtree
 			right->data = item;
@@ -324,22 +345,25 @@ bool AVLTree<T>::insert(T item) {
 /*
 Method to replace an item in the tree
 */
-template <typename T>
-bool AVLTree<T>::replace(T item) {
+template <typename T, typename Compare>
+bool AVLTree<T, Compare>::replace(T item) {
 
 	//if node empty, return false
 	if (empty) {
 		return false;
 	}
 
+	//compares once, the result picks the branch below
+	int comparison = comparator->compare(item, data);
+
 	//if item equals node, replace and return true
-	else if (comparator->compare(item, data) == 0) {
+	if (comparison == 0) {
 		data = item;
 		return true;
 	}
 
 	//if item less than node, replace in left subtree
-	else if (comparator->compare(item, data) == -1) {
+	else if (comparison == -1) {
 
 		//if left is null return false
 		if (left == nullptr) {
@@ -350,7 +374,7 @@ bool AVLTree<T>::replace(T item) {
 	}
 
 	//if item greater than node, replace in right subtree
-	else if (comparator->compare(item, data) == 1) {
+	else if (comparison == 1) {
 
 		//if right is null return false
 		if (right == nullptr) {
@@ -367,16 +391,19 @@ bool AVLTree<T>::replace(T item) {
 /*
 Method to remove item from the tree
 */
-template <typename T>
-bool AVLTree<T>::remove(T item) {
+template <typename T, typename Compare>
+bool AVLTree<T, Compare>::remove(T item) {
 
 	//if node empty, return false
 	if (empty) {
 		return false;
 	}
 
+	//compares once, the result picks the branch below
+	int comparison = comparator->compare(item, data);
+
 	//if item already present, return false
-	else if (comparator->compare(item, data) == 0) {
+	if (comparison == 0) {
 
 		//if leaf node, set to empty;
 		if (left == nullptr && right == nullptr) {
@@ -395,7 +422,7 @@ bool AVLTree<T>::remove(T item) {
 		//else use right child
 		else {
 			//assign temp tree to right child
-			AVLTree<T>* tempTree = right;
+			AVLTree<T, Compare>* tempTree = right;
 
 			//find the farthest left element in the right subtree
 			while (tempTree->left != nullptr) {
@@ -423,7 +450,7 @@ bool AVLTree<T>::remove(T item) {
 	}
 
 	//if item less than node, remove from left subtree
-	else if (comparator->compare(item, data) == -1) {
+	else if (comparison == -1) {
 
 		if (left == nullptr) {
 			return false;
@@ -455,7 +482,7 @@ bool AVLTree<T>::remove(T item) {
 	}
 
 	//if item greater than node, remove from right subtree
-	else if (comparator->compare(item, data) == 1) {
+	else if (comparison == 1) {
 		
 		if (right == nullptr) {
 			return false;
@@ -491,21 +518,24 @@ bool AVLTree<T>::remove(T item) {
 /*
 Method to check if the tree contains an item
 */
-template <typename T>
-bool AVLTree<T>::contains(T item) const {
+template <typename T, typename Compare>
+bool AVLTree<T, Compare>::contains(T item) const {
 
 	//if node empty, return false
 	if (empty) {
 		return false;
 	}
 
+	//compares once, the result picks the branch below
+	int comparison = comparator->compare(item, data);
+
 	//if item matches, return true
-	else if (comparator->compare(item, data) == 0) {
+	if (comparison == 0) {
 		return true;
 	}
 
 	//if item less than node, check in left subtree
-	else if (comparator->compare(item, data) == -1) {
+	else if (comparison == -1) {
 
 		//if left null return false
 		if (left == nullptr) {
@@ -515,7 +545,7 @@ bool AVLTree<T>::contains(T item) const {
 	}
 
 	//if item greater than node, check in right subtree
-	else if (comparator->compare(item, data) == 1) {
+	else if (comparison == 1) {
 
 		//if right null return false
 		if (right == nullptr) {
@@ -531,21 +561,24 @@ bool AVLTree<T>::contains(T item) const {
 /*
 Method to find an item within the tree
 */
-template <typename T>
-T AVLTree<T>::find(const T item) const {
+template <typename T, typename Compare>
+T AVLTree<T, Compare>::find(const T item) const {
 
 	//if node empty, throw exception
 	if (empty) {
 		throw new ExceptionAVLTreeAccess;
 	}
 
+	//compares once, the result picks the branch below
+	int comparison = comparator->compare(item, data);
+
 	//if item already present, return item
-	else if (comparator->compare(item, data) == 0) {
+	if (comparison == 0) {
 		return data;
 	}
 
 	//if item less than node, check in left subtree
-	else if (comparator->compare(item, data) == -1) {
+	else if (comparison == -1) {
 
 		//if left null throw exception
 		if (left == nullptr) {
@@ -555,7 +588,7 @@ T AVLTree<T>::find(const T item) const {
 	}
 
 	//if item greater than node, check in in right subtree
-	else if (comparator->compare(item, data) == 1) {
+	else if (comparison == 1) {
 
 		//if right null throw exception
 		if (right == nullptr) {
@@ -571,11 +604,79 @@ T AVLTree<T>::find(const T item) const {
 }
 
 
+/*
+Method to find the node holding an item with the given key
+*/
+template <typename T, typename Compare>
+template <typename K>
+const AVLTree<T, Compare>* AVLTree<T, Compare>::findKeyNode(const K& key) const {
+
+	//the key is compared without virtual dispatch when the comparator type already says it is a KeyComparator
+	if constexpr (std::is_base_of<KeyComparator<T, K>, Compare>::value) {
+		return descendKey(key, *comparator);
+	}
+	else if constexpr (std::is_polymorphic<Compare>::value) {
+		const KeyComparator<T, K>* keyComparator = dynamic_cast<const KeyComparator<T, K>*>(comparator);
+		if (keyComparator == nullptr) {
+			throw new ExceptionAVLTreeAccess;
+		}
+		return descendKey(key, *keyComparator);
+	}
+	else {
+		throw new ExceptionAVLTreeAccess;
+	}
+}
+
+
+/*
+Method to walk down from this node to the one holding an item with the given key
+*/
+template <typename T, typename Compare>
+template <typename K, typename Keyed>
+const AVLTree<T, Compare>* AVLTree<T, Compare>::descendKey(const K& key, const Keyed& keyComparator) const {
+	const AVLTree<T, Compare>* node = this;
+
+	//goes left or right from each node until the key matches or there is no subtree to go to
+	while (node != nullptr && !node->empty) {
+		int comparison = keyComparator.compareKey(key, node->data);
+		if (comparison == 0) {
+			return node;
+		}
+		node = (comparison < 0) ? node->left : node->right;
+	}
+	return nullptr;
+}
+
+
+/*
+Method to check if the tree contains an item with the given key
+*/
+template <typename T, typename Compare>
+template <typename K>
+bool AVLTree<T, Compare>::containsKey(const K& key) const {
+	return findKeyNode(key) != nullptr;
+}
+
+
+/*
+Method to find an item within the tree by its key
+*/
+template <typename T, typename Compare>
+template <typename K>
+T AVLTree<T, Compare>::findKey(const K& key) const {
+	const AVLTree<T, Compare>* node = findKeyNode(key);
+	if (node == nullptr) {
+		throw new ExceptionAVLTreeAccess;
+	}
+	return node->data;
+}
+
+
 /*
 Method to get the size of the tree
 */
-template <typename T>
-unsigned long AVLTree<T>::getSize() const {
+template <typename T, typename Compare>
+unsigned long AVLTree<T, Compare>::getSize() const {
 	return size;
 }
 
@@ -583,7 +684,7 @@ unsigned long AVLTree<T>::getSize() const {
 /*
 Method to return an enumerator for the tree
 */
-template <typename T>
-AVLTreeEnumerator<T> AVLTree<T>::enumerator(AVLTreeOrder order) const {
-	return AVLTreeEnumerator<T>(this, order);
+template <typename T, typename Compare>
+AVLTreeEnumerator<T, Compare> AVLTree<T, Compare>::enumerator(AVLTreeOrder order) const {
+	return AVLTreeEnumerator<T, Compare>(this, order);
 }
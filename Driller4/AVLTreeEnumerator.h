@@ -4,24 +4,26 @@
 
 #include <stack>
 #include "Enumerator.h"
+#include "Comparator.h"
 #include "AVLTreeOrder.h"
 
-template <typename S>
+// Compare is the comparator type the tree calls, a final comparator class lets the tree inline compare
+template <typename S, typename Compare = Comparator<S>>
 class AVLTree;
 
-template <typename T>
+template <typename T, typename Compare = Comparator<T>>
 class AVLTreeEnumerator : public Enumerator<T>
 {
 private:
 	AVLTreeOrder order;
-	std::stack<const AVLTree<T>*> traversalStack;
-	void buildTraversalStack(const AVLTree<T>* current);
-	void buildInOrder(const AVLTree<T>* current);
-	void buildPreOrder(const AVLTree<T>* current);
-	void buildPostOrder(const AVLTree<T>* current);
+	std::stack<const AVLTree<T, Compare>*> traversalStack;
+	void buildTraversalStack(const AVLTree<T, Compare>* current);
+	void buildInOrder(const AVLTree<T, Compare>* current);
+	void buildPreOrder(const AVLTree<T, Compare>* current);
+	void buildPostOrder(const AVLTree<T, Compare>* current);
 
 public:
-	AVLTreeEnumerator(const AVLTree<T>* root, AVLTreeOrder order = AVLTreeOrder::inorder);
+	AVLTreeEnumerator(const AVLTree<T, Compare>* root, AVLTreeOrder order = AVLTreeOrder::inorder);
 	virtual ~AVLTreeEnumerator();
 	bool hasNext() const;
 	T next();                        // throws ExceptionEnumerationBeyondEnd if no next item is available
@@ -34,8 +36,8 @@ public:
 /*
 Constructor for an AVLTreeEnumerator, takes a root node and the order
 */
-template <typename T>
-AVLTreeEnumerator<T>::AVLTreeEnumerator(const AVLTree<T>* root, AVLTreeOrder order) {
+template <typename T, typename Compare>
+AVLTreeEnumerator<T, Compare>::AVLTreeEnumerator(const AVLTree<T, Compare>* root, AVLTreeOrder order) {
 
 	//if root contains nothing throw exception
 	if (root->empty) {
@@ -50,8 +52,8 @@ AVLTreeEnumerator<T>::AVLTreeEnumerator(const AVLTree<T>* root, AVLTreeOrder ord
 /*
 Destructor for the enumerator
 */
-template <typename T>
-AVLTreeEnumerator<T>::~AVLTreeEnumerator() {
+template <typename T, typename Compare>
+AVLTreeEnumerator<T, Compare>::~AVLTreeEnumerator() {
 	
 }
 
@@ -59,8 +61,8 @@ AVLTreeEnumerator<T>::~AVLTreeEnumerator() {
 /*
 Method to see if enumerator has next element
 */
-template <typename T>
-bool AVLTreeEnumerator<T>::hasNext() const {
+template <typename T, typename Compare>
+bool AVLTreeEnumerator<T, Compare>::hasNext() const {
 	
 	//checks if stack is empty and returns appropriate bool
 	if (traversalStack.empty()) {
@@ -75,8 +77,8 @@ bool AVLTreeEnumerator<T>::hasNext() const {
 /*
 Method to get the next element in the stack
 */
-template <typename T>
-T AVLTreeEnumerator<T>::next() {
+template <typename T, typename Compare>
+T AVLTreeEnumerator<T, Compare>::next() {
 
 	//if stack empty throw exception
 	if (traversalStack.empty()) {
@@ -85,7 +87,7 @@ T AVLTreeEnumerator<T>::next() {
 
 	//else pop element off stack
 	else {
-		const AVLTree<T>* tempRecord = traversalStack.top();
+		const AVLTree<T, Compare>* tempRecord = traversalStack.top();
 		traversalStack.pop();
 		return tempRecord->data;
 	}
@@ -95,8 +97,8 @@ T AVLTreeEnumerator<T>::next() {
 /*
 Method to get next element with out removing it
 */
-template <typename T>
-T AVLTreeEnumerator<T>::peek() const {
+template <typename T, typename Compare>
+T AVLTreeEnumerator<T, Compare>::peek() const {
 
 	//if stack empty throw exception
 	if (traversalStack.empty()) {
@@ -105,7 +107,7 @@ T AVLTreeEnumerator<T>::peek() const {
 
 	//else return top element without removing
 	else {
-		const AVLTree<T>* tempRecord = traversalStack.top();
+		const AVLTree<T, Compare>* tempRecord = traversalStack.top();
 		return tempRecord->data;
 	}
 }
@@ -114,8 +116,8 @@ T AVLTreeEnumerator<T>::peek() const {
 /*
 Method to return the current order of the enumerator
 */
-template <typename T>
-AVLTreeOrder AVLTreeEnumerator<T>::getOrder() {
+template <typename T, typename Compare>
+AVLTreeOrder AVLTreeEnumerator<T, Compare>::getOrder() {
 	return order;
 }
 
@@ -123,8 +125,8 @@ AVLTreeOrder AVLTreeEnumerator<T>::getOrder() {
 /*
 Method to build the traversal stack for the tree
 */
-template <typename T>
-void AVLTreeEnumerator<T>::buildTraversalStack(const AVLTree<T>* current) {
+template <typename T, typename Compare>
+void AVLTreeEnumerator<T, Compare>::buildTraversalStack(const AVLTree<T, Compare>* current) {
 
 	//branch for a preorder traversal
 	if (order == AVLTreeOrder::preorder) {
@@ -146,8 +148,8 @@ void AVLTreeEnumerator<T>::buildTraversalStack(const AVLTree<T>* current) {
 /*
 Method to build the traversal stack in order
 */
-template <typename T>
-void AVLTreeEnumerator<T>::buildInOrder(const AVLTree<T>* current) {
+template <typename T, typename Compare>
+void AVLTreeEnumerator<T, Compare>::buildInOrder(const AVLTree<T, Compare>* current) {
 	
 	//if right child exists, recursion onto that child
 	if (current->right != nullptr) {
@@ -169,8 +171,8 @@ void AVLTreeEnumerator<T>::buildInOrder(const AVLTree<T>* current) {
 /*
 Method to build the traversal stack pre order
 */
-template<typename T>
-void AVLTreeEnumerator<T>::buildPreOrder(const AVLTree<T>* current) {
+template <typename T, typename Compare>
+void AVLTreeEnumerator<T, Compare>::buildPreOrder(const AVLTree<T, Compare>* current) {
 
 	//if right child exists, call function on it
 	if (current->right != nullptr) {
@@ -192,8 +194,8 @@ void AVLTreeEnumerator<T>::buildPreOrder(const AVLTree<T>* current) {
 /*
 Method to build traversal stack in post order
 */
-template <typename T>
-void AVLTreeEnumerator<T>::buildPostOrder(const AVLTree<T>* current) {
+template <typename T, typename Compare>
+void AVLTreeEnumerator<T, Compare>::buildPostOrder(const AVLTree<T, Compare>* current) {
 
 	//push current node
 	if (!current->empty) {
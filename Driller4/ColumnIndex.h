@@ -0,0 +1,269 @@
+#pragma once
+#ifndef COLUMN_INDEX_H
+#define COLUMN_INDEX_H
+
+#include <vector>
+#include "Exceptions.h"
+#include "ResizableArray.h"
+#include "Sorter.h"
+#include "Search.h"
+#include "EytzingerLayout.h"
+#include "ColumnScan.h"
+#include "DrillingRecord.h"
+#include "DrillingRecordColumnComparator.h"
+
+const unsigned int INDEXED_COLUMNS = MAX_STRINGS + MAX_NUMS;      // number of record columns that can be indexed
+
+// ColumnView presents the records of an array in the order of one column index, it has getSize and
+// getUnchecked so the searches in Search.h work on it as they do on a sorted array
+template <typename Array>
+class ColumnView {
+private:
+	const Array* array;                                        // the records
+	const ResizableArray<unsigned long>* order;                // position in array of each record, in column order
+public:
+	ColumnView(const Array* array, const ResizableArray<unsigned long>* order);  // views array through order
+	const DrillingRecord& getUnchecked(unsigned long rank) const;  // returns the record at rank in column order, rank must be less than size
+	unsigned long getPosition(unsigned long rank) const;       // returns the position in the array of the record at rank
+	unsigned long getSize() const;                             // returns the number of records
+};
+
+// ColumnIndex keeps, for each column that has been searched, the positions of the records of an array
+// sorted by that column, so any column can be searched without reordering the array
+// each index is built the first time its column is asked for and must be invalidated whenever
+// records are added, removed or moved
+// with static search on, a column whose records all have sort keys also gets an EytzingerLayout of
+// the keys, which answers the searches below with fewer cache misses than a binary search of the records
+// numeric columns can also be scanned without an index, from a copy of the column's values that is
+// made on the first scan and dropped with the indexes
+template <typename Array>
+class ColumnIndex {
+private:
+	const Array* array;                                        // the records being indexed
+	ResizableArray<unsigned long>* orders[INDEXED_COLUMNS];    // sorted positions for each column, nullptr until built
+	EytzingerLayout* layouts[INDEXED_COLUMNS];                 // sort keys of each column in search order, nullptr if not built
+	std::vector<double>* values[MAX_NUMS];                     // values of each numeric column in array order, nullptr until copied
+	unsigned int threadCount;                                  // threads used to build an index, 0 uses every hardware thread
+	bool staticSearch;                                         // true if layouts are built along with the indexes
+	void build(unsigned int column);                           // sorts the positions of the records by column
+public:
+	ColumnIndex(const Array* array, unsigned int threadCount, bool staticSearch);  // creates an index of array with no column built yet
+	ColumnIndex(const ColumnIndex<Array>&) = delete;           // the indexes belong to a single array
+	ColumnIndex<Array>& operator=(const ColumnIndex<Array>&) = delete;
+	virtual ~ColumnIndex();                                    // frees every built index
+
+	// returns the records in order of column, building the index first if it doesn't exist
+	// throws ExceptionIndexOutOfRange if column is not a record column
+	ColumnView<Array> view(unsigned int column);
+
+	// returns the ranks in column order of the records whose column equals item's
+	SearchRange equalRange(unsigned int column, const DrillingRecord& item);
+
+	// returns the ranks in column order of the records whose column is from low's to high's inclusive
+	SearchRange rangeSearch(unsigned int column, const DrillingRecord& low, const DrillingRecord& high);
+
+	// adds to rows the array position of every record whose numeric column passes comparison, in array order
+	// throws ExceptionIndexOutOfRange if column is not a numeric column
+	void scan(unsigned int column, ScanComparison comparison, double low, double high, ResizableArray<unsigned long>& rows);
+
+	bool isBuilt(unsigned int column) const;                   // returns true if column has an index that is up to date
+	void invalidate();                                         // frees every index and column copy, they are rebuilt as they are needed
+};
+
+/*
+Constructor, the view is only valid as long as the index it came from is
+*/
+template <typename Array>
+ColumnView<Array>::ColumnView(const Array* array, const ResizableArray<unsigned long>* order) {
+	this->array = array;
+	this->order = order;
+}
+
+/*
+Method to get the record at a rank in column order
+*/
+template <typename Array>
+const DrillingRecord& ColumnView<Array>::getUnchecked(unsigned long rank) const {
+	return array->getUnchecked(order->getUnchecked(rank));
+}
+
+/*
+Method to get the array position of the record at a rank in column order
+*/
+template <typename Array>
+unsigned long ColumnView<Array>::getPosition(unsigned long rank) const {
+	return order->getUnchecked(rank);
+}
+
+/*
+Method to get the number of records in the view
+*/
+template <typename Array>
+unsigned long ColumnView<Array>::getSize() const {
+	return order->getSize();
+}
+
+/*
+Constructor, nothing is built until a column is viewed
+*/
+template <typename Array>
+ColumnIndex<Array>::ColumnIndex(const Array* array, unsigned int threadCount, bool staticSearch) {
+	this->array = array;
+	this->threadCount = threadCount;
+	this->staticSearch = staticSearch;
+	for (unsigned int i = 0; i < INDEXED_COLUMNS; i++) {
+		orders[i] = nullptr;
+		layouts[i] = nullptr;
+	}
+	for (unsigned int i = 0; i < MAX_NUMS; i++) {
+		values[i] = nullptr;
+	}
+}
+
+/*
+Destructor
+*/
+template <typename Array>
+ColumnIndex<Array>::~ColumnIndex() {
+	invalidate();
+}
+
+/*
+Method to build the index of a column, equal values keep the order they have in the array
+*/
+template <typename Array>
+void ColumnIndex<Array>::build(unsigned int column) {
+	ResizableArray<unsigned long>* order = new ResizableArray<unsigned long>;
+	withColumnComparator(column, [&](const auto& columnComp) {
+		Sorter<DrillingRecord>::sortedOrder(*array, columnComp, threadCount, *order);
+
+		//lays out the keys in column order, unless a record has no key
+		if (staticSearch) {
+			std::vector<unsigned long long> keys(order->getSize());
+			for (unsigned long i = 0; i < order->getSize(); i++) {
+				if (!columnComp.getSortKey(array->getUnchecked(order->getUnchecked(i)), keys[i])) {
+					return;
+				}
+			}
+			layouts[column] = new EytzingerLayout;
+			layouts[column]->build(keys);
+		}
+	});
+	orders[column] = order;
+}
+
+/*
+Method to view the records in order of a column
+*/
+template <typename Array>
+ColumnView<Array> ColumnIndex<Array>::view(unsigned int column) {
+
+	//makes sure the column exists and throws an exception otherwise
+	if (column >= INDEXED_COLUMNS) {
+		throw new ExceptionIndexOutOfRange();
+	}
+
+	//builds the index on first use
+	if (orders[column] == nullptr) {
+		build(column);
+	}
+	return ColumnView<Array>(array, orders[column]);
+}
+
+/*
+Method to find the records equal to a record in a column
+The layout is searched when the column has one and the searched value has a key, the records
+themselves are binary searched otherwise
+*/
+template <typename Array>
+SearchRange ColumnIndex<Array>::equalRange(unsigned int column, const DrillingRecord& item) {
+	ColumnView<Array> columnView = view(column);
+	SearchRange range;
+	withColumnComparator(column, [&](const auto& columnComp) {
+		unsigned long long key;
+		if (layouts[column] != nullptr && columnComp.getSortKey(item, key)) {
+			range.first = layouts[column]->lowerBound(key);
+			range.last = layouts[column]->upperBound(key);
+		}
+		else {
+			range = equalRangeArray(item, columnView, columnComp);
+		}
+	});
+	return range;
+}
+
+/*
+Method to find the records from one record to another in a column
+*/
+template <typename Array>
+SearchRange ColumnIndex<Array>::rangeSearch(unsigned int column, const DrillingRecord& low, const DrillingRecord& high) {
+	ColumnView<Array> columnView = view(column);
+	SearchRange range;
+	withColumnComparator(column, [&](const auto& columnComp) {
+		unsigned long long lowKey;
+		unsigned long long highKey;
+		if (layouts[column] != nullptr && columnComp.getSortKey(low, lowKey) && columnComp.getSortKey(high, highKey)) {
+			range.first = layouts[column]->lowerBound(lowKey);
+			range.last = layouts[column]->upperBound(highKey);
+
+			//a low above high gives an empty range
+			if (range.last < range.first) {
+				range.last = range.first;
+			}
+		}
+		else {
+			range = rangeSearchArray(low, high, columnView, columnComp);
+		}
+	});
+	return range;
+}
+
+/*
+Method to scan a numeric column for the records that pass a comparison
+The column's values are copied next to each other on the first scan so the scan reads them in vectors
+*/
+template <typename Array>
+void ColumnIndex<Array>::scan(unsigned int column, ScanComparison comparison, double low, double high, ResizableArray<unsigned long>& rows) {
+
+	//makes sure the column is numeric and throws an exception otherwise
+	if (column < MAX_STRINGS || column >= INDEXED_COLUMNS) {
+		throw new ExceptionIndexOutOfRange();
+	}
+	unsigned int num = column - MAX_STRINGS;
+
+	//copies the column on first use
+	if (values[num] == nullptr) {
+		values[num] = new std::vector<double>(array->getSize());
+		for (unsigned long i = 0; i < array->getSize(); i++) {
+			(*values[num])[i] = array->getUnchecked(i).getNum(num);
+		}
+	}
+	scanColumn(values[num]->data(), (unsigned long)values[num]->size(), comparison, low, high, rows);
+}
+
+/*
+Method to check if a column has an index
+*/
+template <typename Array>
+bool ColumnIndex<Array>::isBuilt(unsigned int column) const {
+	return column < INDEXED_COLUMNS && orders[column] != nullptr;
+}
+
+/*
+Method to free every index, layout and column copy
+*/
+template <typename Array>
+void ColumnIndex<Array>::invalidate() {
+	for (unsigned int i = 0; i < INDEXED_COLUMNS; i++) {
+		delete orders[i];
+		orders[i] = nullptr;
+		delete layouts[i];
+		layouts[i] = nullptr;
+	}
+	for (unsigned int i = 0; i < MAX_NUMS; i++) {
+		delete values[i];
+		values[i] = nullptr;
+	}
+}
+
+#endif // !COLUMN_INDEX_H
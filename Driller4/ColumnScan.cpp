@@ -0,0 +1,135 @@
+#include "ColumnScan.h"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define COLUMN_SCAN_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define COLUMN_SCAN_SSE2
+#endif
+
+/*
+Function to test one value, the comparisons are all false for NaN
+*/
+template <ScanComparison COMPARISON>
+static inline bool passes(double value, double low, double high) {
+	if constexpr (COMPARISON == ScanComparison::equal) {
+		return value == low;
+	}
+	else if constexpr (COMPARISON == ScanComparison::less) {
+		return value < low;
+	}
+	else if constexpr (COMPARISON == ScanComparison::greater) {
+		return value > low;
+	}
+	else {
+		return value >= low && value <= high;
+	}
+}
+
+/*
+Function to add the positions picked out by a mask, bit b of mask stands for position first + b
+*/
+static inline void addMasked(int mask, unsigned long first, ResizableArray<unsigned long>& rows) {
+	for (unsigned long bit = 0; mask != 0; bit++, mask >>= 1) {
+		if (mask & 1) {
+			rows.add(first + bit);
+		}
+	}
+}
+
+#if defined(COLUMN_SCAN_AVX)
+/*
+Function to test 4 values at once, each lane of the result is all ones if its value passed
+*/
+template <ScanComparison COMPARISON>
+static inline __m256d passes(__m256d values, __m256d low, __m256d high) {
+	if constexpr (COMPARISON == ScanComparison::equal) {
+		return _mm256_cmp_pd(values, low, _CMP_EQ_OQ);
+	}
+	else if constexpr (COMPARISON == ScanComparison::less) {
+		return _mm256_cmp_pd(values, low, _CMP_LT_OQ);
+	}
+	else if constexpr (COMPARISON == ScanComparison::greater) {
+		return _mm256_cmp_pd(values, low, _CMP_GT_OQ);
+	}
+	else {
+		return _mm256_and_pd(_mm256_cmp_pd(values, low, _CMP_GE_OQ), _mm256_cmp_pd(values, high, _CMP_LE_OQ));
+	}
+}
+#elif defined(COLUMN_SCAN_SSE2)
+/*
+Function to test 2 values at once, each lane of the result is all ones if its value passed
+*/
+template <ScanComparison COMPARISON>
+static inline __m128d passes(__m128d values, __m128d low, __m128d high) {
+	if constexpr (COMPARISON == ScanComparison::equal) {
+		return _mm_cmpeq_pd(values, low);
+	}
+	else if constexpr (COMPARISON == ScanComparison::less) {
+		return _mm_cmplt_pd(values, low);
+	}
+	else if constexpr (COMPARISON == ScanComparison::greater) {
+		return _mm_cmpgt_pd(values, low);
+	}
+	else {
+		return _mm_and_pd(_mm_cmpge_pd(values, low), _mm_cmple_pd(values, high));
+	}
+}
+#endif
+
+/*
+Function to scan the values with one comparison, vector at a time and then the values left over one at a time
+*/
+template <ScanComparison COMPARISON>
+static void scanWith(const double* values, unsigned long count, double low, double high, ResizableArray<unsigned long>& rows) {
+	unsigned long i = 0;
+
+#if defined(COLUMN_SCAN_AVX)
+	__m256d lowValues = _mm256_set1_pd(low);
+	__m256d highValues = _mm256_set1_pd(high);
+	for (; i + 4 <= count; i += 4) {
+		int mask = _mm256_movemask_pd(passes<COMPARISON>(_mm256_loadu_pd(values + i), lowValues, highValues));
+		if (mask != 0) {
+			addMasked(mask, i, rows);
+		}
+	}
+#elif defined(COLUMN_SCAN_SSE2)
+	__m128d lowValues = _mm_set1_pd(low);
+	__m128d highValues = _mm_set1_pd(high);
+	for (; i + 2 <= count; i += 2) {
+		int mask = _mm_movemask_pd(passes<COMPARISON>(_mm_loadu_pd(values + i), lowValues, highValues));
+		if (mask != 0) {
+			addMasked(mask, i, rows);
+		}
+	}
+#endif
+
+	for (; i < count; i++) {
+		if (passes<COMPARISON>(values[i], low, high)) {
+			rows.add(i);
+		}
+	}
+}
+
+/*
+Function to scan a column of values for the ones that pass a comparison
+*/
+void scanColumn(const double* values, unsigned long count, ScanComparison comparison, double low, double high, ResizableArray<unsigned long>& rows) {
+
+	//each comparison gets its own loop so the test isn't chosen again for every value
+	switch (comparison) {
+	case ScanComparison::equal:
+		scanWith<ScanComparison::equal>(values, count, low, high, rows);
+		break;
+	case ScanComparison::less:
+		scanWith<ScanComparison::less>(values, count, low, high, rows);
+		break;
+	case ScanComparison::greater:
+		scanWith<ScanComparison::greater>(values, count, low, high, rows);
+		break;
+	case ScanComparison::between:
+		scanWith<ScanComparison::between>(values, count, low, high, rows);
+		break;
+	}
+}
@@ -0,0 +1,20 @@
+#pragma once
+#ifndef COLUMN_SCAN_H
+#define COLUMN_SCAN_H
+
+#include "ResizableArray.h"
+
+// the test a value has to pass to be picked by scanColumn
+enum class ScanComparison {
+	equal,                                             // value == low
+	less,                                              // value < low
+	greater,                                           // value > low
+	between                                            // low <= value <= high
+};
+
+// adds to rows the position of every value from values[0] to values[count - 1] that passes the comparison,
+// in position order, NaN values never pass
+// compares 4 values at a time when built with AVX, 2 at a time with SSE2, and one at a time otherwise
+void scanColumn(const double* values, unsigned long count, ScanComparison comparison, double low, double high, ResizableArray<unsigned long>& rows);
+
+#endif // !COLUMN_SCAN_H
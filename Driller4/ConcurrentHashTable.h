@@ -0,0 +1,421 @@
+#pragma once
+#ifndef CONCURRENT_HASH_TABLE_H
+#define CONCURRENT_HASH_TABLE_H
+
+#include <atomic>
+#include <mutex>
+#include "Exceptions.h"
+#include "Comparator.h"
+#include "Hasher.h"
+#include "KeyHasher.h"
+#include "KeyComparator.h"
+#include "HashTable.h"
+#include "EpochReclaimer.h"
+
+const unsigned int LOCK_STRIPES = 64;                          // writer locks, each covers the buckets equal to it mod LOCK_STRIPES
+
+// ConcurrentHashTable keeps the HashTable contract for insert, replace, remove, find and findKey but every
+// method can be called from several threads at once, so records can be looked up while a merge adds them
+// readers take no lock: they walk chains of atomic pointers inside an EpochGuard, and nodes are only
+// linked in once they are complete, so a reader sees each item either before or after a change
+// writers lock the stripe of the bucket they change, so writers to different stripes don't wait on each other
+// a resize locks every stripe, copies the chains into a table of the next SCHEDULE size and swaps one
+// pointer, readers already in the old table finish there, and replaced nodes and old tables are
+// deleted by the EpochReclaimer once no reader can reach them
+// the table grows at the max load factor but never shrinks
+template <typename T>
+class ConcurrentHashTable {
+private:
+	struct Node {
+		T item;                                                // the item, never changed once the node is linked
+		unsigned long hash;                                    // hash of the item, so probes and resizes don't rehash
+		std::atomic<Node*> next;                               // next node in the chain
+		Node(const T& item, unsigned long hash, Node* next) : item(item), hash(hash), next(next) {}
+	};
+	struct Table {
+		unsigned int scheduleIndex;                            // index of capacity in SCHEDULE
+		unsigned long capacity;                                // the number of buckets
+		std::atomic<Node*>* buckets;                           // the first node of each chain
+		Table(unsigned int scheduleIndex);
+		~Table();                                              // deletes the buckets and every node still in them
+	};
+	struct alignas(64) Stripe {
+		std::mutex lock;                                       // held by a writer changing a bucket of the stripe
+	};
+	Comparator<T>* comparator;                                 // used to determine item equality
+	Hasher<T>* hasher;                                         // used to compute hash value
+	float maxLoadFactor = DEFAULT_MAX_LOAD_FACTOR;
+	std::atomic<Table*> table;                                 // the current table, swapped by a resize
+	std::atomic<unsigned long> size{ 0 };                      // actual number of items currently in hash table
+	Stripe stripes[LOCK_STRIPES];
+	mutable EpochReclaimer reclaimer;                          // frees what readers may still be looking at
+	Table* lockStripe(unsigned long hash, unsigned int& stripe);   // locks the item's stripe of the current table
+	void grow(unsigned int fullIndex);                         // moves to the next table size if still at SCHEDULE[fullIndex]
+	template <typename K>
+	bool findKeyItem(const K& key, T* item) const;             // copies the item with key into item if given, false if none
+public:
+	ConcurrentHashTable(Comparator<T>* comparator, Hasher<T>* hasher);      // creates an empty table of DEFAULT_BASE_CAPACITY
+	ConcurrentHashTable(Comparator<T>* comparator, Hasher<T>* hasher,
+		// if size given, creates empty table with size from schedule of sufficient capacity (considering maxLoadFactor)
+		unsigned long size,
+		float maxLoadFactor = DEFAULT_MAX_LOAD_FACTOR);
+	ConcurrentHashTable(const ConcurrentHashTable<T>&) = delete;
+	ConcurrentHashTable<T>& operator=(const ConcurrentHashTable<T>&) = delete;
+	virtual ~ConcurrentHashTable();                            // no other thread may be using the table
+
+	// if an equivalent item is not already present, insert item and return true
+	// if an equivalent item is already present, leave table unchanged and return false
+	bool insert(T item);
+
+	// if an equivalent item is already present, replace item and return true
+	// if an equivalent item is not already present, leave table unchanged and return false
+	bool replace(T item);
+
+	// if an equivalent item is already present, remove item and return true
+	// if an equivalent item is not already present, leave table unchanged and return false
+	bool remove(T item);
+
+	// if an equivalent item is present, return true
+	// if an equivalent item is not present, return false
+	bool contains(const T& item) const;
+
+	// if an equivalent item is present, return a copy of the item
+	// if an equivalent item is not present, throw a new ExceptionHashTableAccess
+	T find(const T& item) const;
+
+	// lookups by a key of type K instead of a whole item, the hasher has to be a KeyHasher<K> and the
+	// comparator a KeyComparator<T, K>, otherwise they throw a new ExceptionHashTableAccess
+	// if an item with the key is present, return true
+	// if an item with the key is not present, return false
+	template <typename K>
+	bool containsKey(const K& key) const;
+
+	// if an item with the key is present, return a copy of the item
+	// if an item with the key is not present, throw a new ExceptionHashTableAccess
+	template <typename K>
+	T findKey(const K& key) const;
+
+	unsigned long getSize() const;                             // returns the current number of items in the table
+	unsigned long getBaseCapacity() const;                     // returns the current number of buckets
+	float getLoadFactor() const;                               // returns the current load factor of the table
+};
+
+/*
+Constructor for a table of empty buckets
+*/
+template <typename T>
+ConcurrentHashTable<T>::Table::Table(unsigned int scheduleIndex) {
+	this->scheduleIndex = scheduleIndex;
+	capacity = SCHEDULE[scheduleIndex];
+	buckets = new std::atomic<Node*>[capacity];
+	for (unsigned long i = 0; i < capacity; i++) {
+		buckets[i].store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+/*
+Destructor for a table, deletes the nodes still in its chains
+*/
+template <typename T>
+ConcurrentHashTable<T>::Table::~Table() {
+	for (unsigned long i = 0; i < capacity; i++) {
+		Node* node = buckets[i].load(std::memory_order_relaxed);
+		while (node != nullptr) {
+			Node* next = node->next.load(std::memory_order_relaxed);
+			delete node;
+			node = next;
+		}
+	}
+	delete[] buckets;
+}
+
+/*
+Constructor to create an empty hash table
+*/
+template <typename T>
+ConcurrentHashTable<T>::ConcurrentHashTable(Comparator<T>* comparator, Hasher<T>* hasher) {
+	this->comparator = comparator;
+	this->hasher = hasher;
+	table.store(new Table(DEFAULT_SCHEDULE_INDEX));
+}
+
+/*
+Constructor to create a hash table with room for the given number of items
+*/
+template <typename T>
+ConcurrentHashTable<T>::ConcurrentHashTable(Comparator<T>* comparator, Hasher<T>* hasher, unsigned long size, float maxLoadFactor) {
+	this->comparator = comparator;
+	this->hasher = hasher;
+	this->maxLoadFactor = maxLoadFactor;
+
+	//finds the first capacity in the schedule that holds size items without passing the max load factor
+	unsigned int scheduleNum = 0;
+	while (scheduleNum + 1 < SCHEDULE_SIZE && (float)size > (float)SCHEDULE[scheduleNum] * maxLoadFactor) {
+		scheduleNum++;
+	}
+	table.store(new Table(scheduleNum));
+}
+
+/*
+Destructor for the hash table, the reclaimer deletes the retired nodes and tables
+*/
+template <typename T>
+ConcurrentHashTable<T>::~ConcurrentHashTable() {
+	delete table.load();
+}
+
+/*
+Method to lock the stripe of an item's bucket in the current table
+A resize holds every stripe, so once the table is confirmed under the lock it can't change until it is released
+*/
+template <typename T>
+typename ConcurrentHashTable<T>::Table* ConcurrentHashTable<T>::lockStripe(unsigned long hash, unsigned int& stripe) {
+	while (true) {
+
+		//stays in a read section until the table is confirmed, so the table can't be freed and a later one
+		//allocated at its address while the stripe is waited on, this can't deadlock since reclaiming never
+		//waits on readers and nothing done under a stripe enters a read section
+		EpochGuard guard(reclaimer);
+		Table* current = table.load(std::memory_order_acquire);
+		stripe = (unsigned int)((hash % current->capacity) % LOCK_STRIPES);
+		stripes[stripe].lock.lock();
+		if (table.load(std::memory_order_acquire) == current) {
+			return current;
+		}
+		stripes[stripe].lock.unlock();
+	}
+}
+
+/*
+Method to move every item into a table of the next size
+The items are copied into new nodes instead of relinked, so a reader still walking the old table never
+follows a pointer into a chain of the new one
+The full table is named by its schedule index, which only goes up, since the table itself may already
+have been replaced and deleted
+*/
+template <typename T>
+void ConcurrentHashTable<T>::grow(unsigned int fullIndex) {
+
+	//holds every stripe in order, so no writer is in either table
+	for (unsigned int i = 0; i < LOCK_STRIPES; i++) {
+		stripes[i].lock.lock();
+	}
+
+	//another writer may have grown the table first
+	Table* current = table.load(std::memory_order_relaxed);
+	Table* larger = nullptr;
+	if (current->scheduleIndex == fullIndex && current->scheduleIndex + 1 < SCHEDULE_SIZE) {
+		larger = new Table(current->scheduleIndex + 1);
+		for (unsigned long i = 0; i < current->capacity; i++) {
+			for (Node* node = current->buckets[i].load(std::memory_order_relaxed); node != nullptr; node = node->next.load(std::memory_order_relaxed)) {
+				std::atomic<Node*>& head = larger->buckets[node->hash % larger->capacity];
+				head.store(new Node(node->item, node->hash, head.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+			}
+		}
+
+		//readers that load the table from here on see the whole new table
+		table.store(larger, std::memory_order_seq_cst);
+	}
+
+	for (unsigned int i = LOCK_STRIPES; i > 0; i--) {
+		stripes[i - 1].lock.unlock();
+	}
+
+	//readers already in the old table keep it until they leave
+	if (larger != nullptr) {
+		reclaimer.retire(current);
+	}
+}
+
+/*
+Method to insert an item into the hash table
+*/
+template <typename T>
+bool ConcurrentHashTable<T>::insert(T item) {
+	unsigned long hash = hasher->hash(item);
+	unsigned int stripe = 0;
+	Table* current = lockStripe(hash, stripe);
+	std::atomic<Node*>& head = current->buckets[hash % current->capacity];
+
+	//leaves the table unchanged if an equivalent item is present
+	for (Node* node = head.load(std::memory_order_relaxed); node != nullptr; node = node->next.load(std::memory_order_relaxed)) {
+		if (node->hash == hash && comparator->compare(node->item, item) == 0) {
+			stripes[stripe].lock.unlock();
+			return false;
+		}
+	}
+
+	//the node is complete before the release store makes it reachable
+	head.store(new Node(item, hash, head.load(std::memory_order_relaxed)), std::memory_order_release);
+	unsigned long newSize = size.fetch_add(1, std::memory_order_relaxed) + 1;
+	bool full = (float)newSize >= (float)current->capacity * maxLoadFactor;
+	unsigned int scheduleIndex = current->scheduleIndex;
+	stripes[stripe].lock.unlock();
+
+	//grows once the stripe is released, since growing takes every stripe
+	if (full) {
+		grow(scheduleIndex);
+	}
+	return true;
+}
+
+/*
+Method to replace an item in the hash table, a new node takes the old one's place so readers never see
+an item half copied
+*/
+template <typename T>
+bool ConcurrentHashTable<T>::replace(T item) {
+	unsigned long hash = hasher->hash(item);
+	unsigned int stripe = 0;
+	Table* current = lockStripe(hash, stripe);
+
+	std::atomic<Node*>* link = &current->buckets[hash % current->capacity];
+	for (Node* node = link->load(std::memory_order_relaxed); node != nullptr; node = node->next.load(std::memory_order_relaxed)) {
+		if (node->hash == hash && comparator->compare(node->item, item) == 0) {
+			link->store(new Node(item, hash, node->next.load(std::memory_order_relaxed)), std::memory_order_seq_cst);
+			stripes[stripe].lock.unlock();
+			reclaimer.retire(node);
+			return true;
+		}
+		link = &node->next;
+	}
+	stripes[stripe].lock.unlock();
+	return false;
+}
+
+/*
+Method to remove an item from the hash table, the unlinked node keeps its next pointer so readers on it
+carry on down the chain
+*/
+template <typename T>
+bool ConcurrentHashTable<T>::remove(T item) {
+	unsigned long hash = hasher->hash(item);
+	unsigned int stripe = 0;
+	Table* current = lockStripe(hash, stripe);
+
+	std::atomic<Node*>* link = &current->buckets[hash % current->capacity];
+	for (Node* node = link->load(std::memory_order_relaxed); node != nullptr; node = node->next.load(std::memory_order_relaxed)) {
+		if (node->hash == hash && comparator->compare(node->item, item) == 0) {
+			link->store(node->next.load(std::memory_order_relaxed), std::memory_order_seq_cst);
+			size.fetch_sub(1, std::memory_order_relaxed);
+			stripes[stripe].lock.unlock();
+			reclaimer.retire(node);
+			return true;
+		}
+		link = &node->next;
+	}
+	stripes[stripe].lock.unlock();
+	return false;
+}
+
+/*
+Method to check if the hash table contains an equivalent item without taking a lock
+*/
+template <typename T>
+bool ConcurrentHashTable<T>::contains(const T& item) const {
+	unsigned long hash = hasher->hash(item);
+	EpochGuard guard(reclaimer);
+
+	Table* current = table.load(std::memory_order_acquire);
+	for (Node* node = current->buckets[hash % current->capacity].load(std::memory_order_acquire); node != nullptr; node = node->next.load(std::memory_order_acquire)) {
+		if (node->hash == hash && comparator->compare(node->item, item) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+Method to find an item in the hash table without taking a lock
+*/
+template <typename T>
+T ConcurrentHashTable<T>::find(const T& item) const {
+	unsigned long hash = hasher->hash(item);
+	EpochGuard guard(reclaimer);
+
+	Table* current = table.load(std::memory_order_acquire);
+	for (Node* node = current->buckets[hash % current->capacity].load(std::memory_order_acquire); node != nullptr; node = node->next.load(std::memory_order_acquire)) {
+		if (node->hash == hash && comparator->compare(node->item, item) == 0) {
+			return node->item;
+		}
+	}
+	throw new ExceptionHashTableAccess;
+}
+
+/*
+Method to copy out the item with the given key without taking a lock, the hasher and comparator are each
+checked once
+*/
+template <typename T>
+template <typename K>
+bool ConcurrentHashTable<T>::findKeyItem(const K& key, T* item) const {
+
+	//checks the hasher and comparator can both work from a key of this type
+	const KeyHasher<K>* keyHasher = dynamic_cast<const KeyHasher<K>*>(hasher);
+	const KeyComparator<T, K>* keyComparator = dynamic_cast<const KeyComparator<T, K>*>(comparator);
+	if (keyHasher == nullptr || keyComparator == nullptr) {
+		throw new ExceptionHashTableAccess;
+	}
+
+	unsigned long hash = keyHasher->hashKey(key);
+	EpochGuard guard(reclaimer);
+	Table* current = table.load(std::memory_order_acquire);
+	for (Node* node = current->buckets[hash % current->capacity].load(std::memory_order_acquire); node != nullptr; node = node->next.load(std::memory_order_acquire)) {
+		if (node->hash == hash && keyComparator->compareKey(key, node->item) == 0) {
+			if (item != nullptr) {
+				*item = node->item;
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+Method to check if the hash table contains an item with the given key
+*/
+template <typename T>
+template <typename K>
+bool ConcurrentHashTable<T>::containsKey(const K& key) const {
+	return findKeyItem(key, (T*)nullptr);
+}
+
+/*
+Method to find an item in the hash table by its key
+*/
+template <typename T>
+template <typename K>
+T ConcurrentHashTable<T>::findKey(const K& key) const {
+	T item;
+	if (!findKeyItem(key, &item)) {
+		throw new ExceptionHashTableAccess;
+	}
+	return item;
+}
+
+/*
+Method to return size of the hash table
+*/
+template <typename T>
+unsigned long ConcurrentHashTable<T>::getSize() const {
+	return size.load(std::memory_order_relaxed);
+}
+
+/*
+Method to return the number of buckets of the current table
+*/
+template <typename T>
+unsigned long ConcurrentHashTable<T>::getBaseCapacity() const {
+	EpochGuard guard(reclaimer);
+	return table.load(std::memory_order_acquire)->capacity;
+}
+
+/*
+Method to return the load factor of the table
+*/
+template <typename T>
+float ConcurrentHashTable<T>::getLoadFactor() const {
+	return (float)getSize() / (float)getBaseCapacity();
+}
+
+#endif // !CONCURRENT_HASH_TABLE_H
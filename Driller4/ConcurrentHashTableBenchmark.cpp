@@ -0,0 +1,349 @@
+// ConcurrentHashTableBenchmark.cpp : stress test and throughput benchmark for ConcurrentHashTable and
+// ConcurrentTimeStampIndex, this file has its own 'main' so it is not part of the Driller4 project
+//
+// build it from this folder with the table's sources, e.g.
+//     g++ -std=c++17 -O2 -pthread ConcurrentHashTableBenchmark.cpp ConcurrentTimeStampIndex.cpp TimeStampIndex.cpp
+//         EpochReclaimer.cpp ResizePolicy.cpp TimeStampHasher.cpp DrillingRecord.cpp DrillingRecordComparator.cpp
+//         DrillingRecordKeyComparator.cpp
+// and add -fsanitize=thread or -fsanitize=address to run the stress test under a sanitizer
+//
+// usage: ConcurrentHashTableBenchmark stress [rounds]    checks the table and index under concurrent readers and writers
+//        ConcurrentHashTableBenchmark [seconds]          prints Mops/s for 99/1, 90/10 and 50/50 read/write mixes on 1 to 16 threads
+
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <string_view>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <chrono>
+#include <random>
+#include "Exceptions.h"
+#include "DrillingRecord.h"
+#include "DrillingRecordKeyComparator.h"
+#include "TimeStampHasher.h"
+#include "HashTable.h"
+#include "ConcurrentHashTable.h"
+#include "TimeStampIndex.h"
+#include "ConcurrentTimeStampIndex.h"
+
+using namespace std;
+
+//one record for each second of a day, the most distinct time stamps one file can hold
+const unsigned long DAY_SECONDS = 86400;
+
+//records whose time stamps stay in the table for the whole stress test
+const unsigned long STABLE_RECORDS = 1000;
+
+//threads of each kind in the stress test
+const unsigned int STRESS_READERS = 4;
+const unsigned int STRESS_WRITERS = 4;
+
+//thread counts and read percentages the benchmark measures
+const unsigned int BENCHMARK_THREADS[] = { 1, 2, 4, 8, 16 };
+const unsigned int BENCHMARK_READ_PERCENT[] = { 99, 90, 50 };
+
+//time stamp and record for each second of the day
+vector<string> timeStamps;
+vector<DrillingRecord> records;
+
+
+/*============================================================================================
+Function to create a record for each second of the day, its time stamp is its key and column 0 its second
+*/
+void createRecords() {
+	timeStamps.resize(DAY_SECONDS);
+	records.resize(DAY_SECONDS);
+	for (unsigned long i = 0; i < DAY_SECONDS; i++) {
+		char timeStamp[16];
+		snprintf(timeStamp, sizeof(timeStamp), "%02lu:%02lu:%02lu", i / 3600, (i / 60) % 60, i % 60);
+		timeStamps[i] = timeStamp;
+		records[i].setString("7/31/2017", 0);
+		records[i].setString(timeStamp, 1);
+		records[i].setNum((double)i, 0);
+	}
+}
+//============================================================================================
+
+
+/*============================================================================================
+Function to run one round of the table stress test, returns the number of failed checks
+Writers each insert their share of the day, replace some records, then remove their odd seconds, while
+readers look records up and check every copy they get back is whole and belongs to the key
+*/
+unsigned long stressTable(unsigned int round) {
+	DrillingRecordKeyComparator comparator(1);
+	TimeStampHasher hasher(TimeHashFunction::seconds);
+	ConcurrentHashTable<DrillingRecord> table(&comparator, &hasher);
+	atomic<unsigned long> failures{ 0 };
+	atomic<bool> writersDone{ false };
+
+	//stable records are present before any thread starts and are only ever replaced by equal copies
+	for (unsigned long i = 0; i < STABLE_RECORDS; i++) {
+		table.insert(records[i]);
+	}
+
+	//starts the writers, each owns the seconds equal to it mod STRESS_WRITERS so its inserts and removes must all succeed
+	vector<thread> threads;
+	for (unsigned int w = 0; w < STRESS_WRITERS; w++) {
+		threads.emplace_back([&, w]() {
+			for (unsigned long k = STABLE_RECORDS + w; k < DAY_SECONDS; k += STRESS_WRITERS) {
+				if (!table.insert(records[k])) failures++;
+				if (k % 7 == 0) table.replace(records[k]);
+				if (k % 3 == 0) table.replace(records[k % STABLE_RECORDS]);
+			}
+			for (unsigned long k = STABLE_RECORDS + w; k < DAY_SECONDS; k += STRESS_WRITERS) {
+				if (k % 2 == 1 && !table.remove(records[k])) failures++;
+			}
+		});
+	}
+
+	//starts the readers, a stable record must always be found and any record found must match its key
+	for (unsigned int r = 0; r < STRESS_READERS; r++) {
+		threads.emplace_back([&, r]() {
+			mt19937 random(r + round * 100);
+			unsigned long lookups = 0;
+			while (!writersDone.load()) {
+				unsigned long k = random() % DAY_SECONDS;
+				try {
+					DrillingRecord found = (k < STABLE_RECORDS) ? table.findKey(string_view(timeStamps[k])) : table.find(records[k]);
+					if (found.getNum(0) != (double)k || found.getString(1) != timeStamps[k]) failures++;
+				}
+				catch (ExceptionHashTableAccess* e) {
+					delete e;
+					if (k < STABLE_RECORDS) failures++;
+				}
+
+				//lets the writers run on machines with fewer cores than threads
+				if (++lookups % 64 == 0) this_thread::yield();
+			}
+		});
+	}
+
+	//waits for the writers, then the readers
+	for (unsigned int i = 0; i < STRESS_WRITERS; i++) {
+		threads[i].join();
+	}
+	writersDone = true;
+	for (unsigned int i = STRESS_WRITERS; i < threads.size(); i++) {
+		threads[i].join();
+	}
+
+	//the stable records and every even second must be left
+	unsigned long expectedSize = STABLE_RECORDS;
+	for (unsigned long k = STABLE_RECORDS; k < DAY_SECONDS; k++) {
+		if (k % 2 == 0) expectedSize++;
+	}
+	if (table.getSize() != expectedSize) failures++;
+	for (unsigned long k = 0; k < DAY_SECONDS; k++) {
+		if (table.containsKey(string_view(timeStamps[k])) != (k < STABLE_RECORDS || k % 2 == 0)) failures++;
+	}
+	return failures;
+}
+//============================================================================================
+
+
+/*============================================================================================
+Function to run one round of the time stamp index stress test, returns the number of failed checks
+One thread adds the day's stamps in order as the ingest merge does, while readers check every stamp it has
+published is found and no stamp is found before it has been added
+*/
+unsigned long stressIndex(unsigned int round) {
+	ConcurrentTimeStampIndex index;
+	atomic<unsigned long> failures{ 0 };
+	atomic<unsigned long> published{ 0 };
+
+	//starts the readers
+	vector<thread> threads;
+	for (unsigned int r = 0; r < STRESS_READERS; r++) {
+		threads.emplace_back([&, r]() {
+			mt19937 random(r + round * 100);
+			unsigned long lookups = 0;
+			while (published.load() < DAY_SECONDS) {
+				unsigned long before = published.load();
+				unsigned long k = random() % DAY_SECONDS;
+				bool found = index.contains(timeStamps[k]);
+				if (k < before && !found) failures++;
+				if (found && k > published.load()) failures++;
+				if (++lookups % 64 == 0) this_thread::yield();
+			}
+		});
+	}
+
+	//adds each stamp once, a second insert of the same stamp must be refused
+	for (unsigned long k = 0; k < DAY_SECONDS; k++) {
+		if (!index.insert(timeStamps[k])) failures++;
+		if (index.insert(timeStamps[k])) failures++;
+		published = k + 1;
+	}
+	for (unsigned int i = 0; i < threads.size(); i++) {
+		threads[i].join();
+	}
+	if (index.getSize() != DAY_SECONDS) failures++;
+	return failures;
+}
+//============================================================================================
+
+
+/*============================================================================================
+HashTable behind one mutex, what a concurrent table has to beat
+*/
+struct MutexTable {
+	DrillingRecordKeyComparator comparator{ 1 };
+	TimeStampHasher hasher{ TimeHashFunction::seconds };
+	HashTable<DrillingRecord> table{ &comparator, &hasher, DAY_SECONDS };
+	mutex lock;
+
+	bool read(unsigned long k) {
+		lock_guard<mutex> guard(lock);
+		return table.containsKey(string_view(timeStamps[k]));
+	}
+	void write(unsigned long k) {
+		lock_guard<mutex> guard(lock);
+		if (!table.remove(records[k])) table.insert(records[k]);
+	}
+};
+//============================================================================================
+
+
+/*============================================================================================
+HashTable behind a shared_mutex, readers share the lock and writers hold it alone
+*/
+struct SharedMutexTable {
+	DrillingRecordKeyComparator comparator{ 1 };
+	TimeStampHasher hasher{ TimeHashFunction::seconds };
+	HashTable<DrillingRecord> table{ &comparator, &hasher, DAY_SECONDS };
+	shared_mutex lock;
+
+	bool read(unsigned long k) {
+		shared_lock<shared_mutex> guard(lock);
+		return table.containsKey(string_view(timeStamps[k]));
+	}
+	void write(unsigned long k) {
+		lock_guard<shared_mutex> guard(lock);
+		if (!table.remove(records[k])) table.insert(records[k]);
+	}
+};
+//============================================================================================
+
+
+/*============================================================================================
+ConcurrentHashTable, readers take no lock and writers lock one stripe
+*/
+struct LockFreeReadTable {
+	DrillingRecordKeyComparator comparator{ 1 };
+	TimeStampHasher hasher{ TimeHashFunction::seconds };
+	ConcurrentHashTable<DrillingRecord> table{ &comparator, &hasher, DAY_SECONDS };
+
+	bool read(unsigned long k) {
+		return table.containsKey(string_view(timeStamps[k]));
+	}
+	void write(unsigned long k) {
+		if (!table.remove(records[k])) table.insert(records[k]);
+	}
+};
+//============================================================================================
+
+
+/*============================================================================================
+Function to measure a table under a read/write mix, returns millions of operations per second
+The table starts holding every record and each write removes a record or puts it back
+*/
+template <typename Table>
+double measureThroughput(unsigned int threadCount, unsigned int readPercent, double seconds) {
+	Table table;
+	for (unsigned long k = 0; k < DAY_SECONDS; k++) {
+		table.write(k);
+	}
+
+	atomic<bool> start{ false };
+	atomic<bool> stop{ false };
+	atomic<unsigned long> operations{ 0 };
+	vector<thread> threads;
+	for (unsigned int t = 0; t < threadCount; t++) {
+		threads.emplace_back([&, t]() {
+			mt19937_64 random(t * 7 + 1);
+			unsigned long count = 0;
+			while (!start.load()) this_thread::yield();
+
+			//checks the stop flag once every 64 operations so it doesn't dominate a fast read
+			while (!stop.load(memory_order_relaxed)) {
+				for (unsigned int j = 0; j < 64; j++) {
+					unsigned long value = random();
+					unsigned long k = (value >> 8) % DAY_SECONDS;
+					if ((value & 127) % 100 < readPercent) {
+						table.read(k);
+					}
+					else {
+						table.write(k);
+					}
+					count++;
+				}
+			}
+			operations += count;
+		});
+	}
+
+	auto began = chrono::steady_clock::now();
+	start = true;
+	this_thread::sleep_for(chrono::duration<double>(seconds));
+	stop = true;
+	for (unsigned int t = 0; t < threads.size(); t++) {
+		threads[t].join();
+	}
+	double elapsed = chrono::duration<double>(chrono::steady_clock::now() - began).count();
+	return (double)operations / elapsed / 1e6;
+}
+//============================================================================================
+
+
+/*============================================================================================
+Function to print one row of the benchmark, a table's throughput on each thread count
+*/
+template <typename Table>
+void printThroughputRow(const string& name, unsigned int readPercent, double seconds) {
+	cout << setw(2) << readPercent << "/" << left << setw(3) << (100 - readPercent) << setw(14) << name << right;
+	for (unsigned int threadCount : BENCHMARK_THREADS) {
+		cout << setw(9) << fixed << setprecision(2) << measureThroughput<Table>(threadCount, readPercent, seconds) << flush;
+	}
+	cout << endl;
+}
+//============================================================================================
+
+
+int main(int argc, char* argv[]) {
+	createRecords();
+
+	//runs the stress test, exits with 1 if any check failed
+	if (argc > 1 && strcmp(argv[1], "stress") == 0) {
+		unsigned int rounds = (argc > 2) ? (unsigned int)atoi(argv[2]) : 3;
+		unsigned long failures = 0;
+		for (unsigned int round = 0; round < rounds; round++) {
+			failures += stressTable(round);
+			failures += stressIndex(round);
+		}
+		cout << ((failures == 0) ? "OK" : "FAILED") << " " << rounds << " rounds, " << failures << " failed checks" << endl;
+		return (failures == 0) ? 0 : 1;
+	}
+
+	//runs the benchmark, each measurement runs for the given number of seconds
+	double seconds = (argc > 1) ? atof(argv[1]) : 0.3;
+	cout << "Mops/s      threads:";
+	for (unsigned int threadCount : BENCHMARK_THREADS) {
+		cout << setw(9) << threadCount;
+	}
+	cout << endl;
+	for (unsigned int readPercent : BENCHMARK_READ_PERCENT) {
+		printThroughputRow<MutexTable>("mutex", readPercent, seconds);
+		printThroughputRow<SharedMutexTable>("shared_mutex", readPercent, seconds);
+		printThroughputRow<LockFreeReadTable>("concurrent", readPercent, seconds);
+	}
+	return 0;
+}
@@ -0,0 +1,65 @@
+#include "ConcurrentTimeStampIndex.h"
+#include "TimeStampIndex.h"
+
+using namespace std;
+
+/*
+Constructor, creates an empty index with room for a day of stamps
+*/
+ConcurrentTimeStampIndex::ConcurrentTimeStampIndex() {
+	table = new ConcurrentHashTable<string>(&comparator, &hasher, CONCURRENT_INDEX_SIZE);
+}
+
+/*
+Destructor for the index
+*/
+ConcurrentTimeStampIndex::~ConcurrentTimeStampIndex() {
+	delete table;
+	table = nullptr;
+}
+
+/*
+Method to compare two time stamps
+*/
+int ConcurrentTimeStampIndex::TextComparator::compare(const string& item1, const string& item2) const {
+	int result = item1.compare(item2);
+	return (result < 0) ? -1 : ((result > 0) ? 1 : 0);
+}
+
+/*
+Method to hash a time stamp
+*/
+unsigned long ConcurrentTimeStampIndex::TextHasher::hash(const string& item) const {
+	return TimeStampIndex::hash(item);
+}
+
+/*
+Method to check if the index contains a time stamp, takes no lock
+An HH:MM:SS stamp fits in the string's own buffer, so the copy looked up with doesn't allocate, and a whole
+item lookup skips the casts a lookup by key has to make
+*/
+bool ConcurrentTimeStampIndex::contains(string_view timeStamp) const {
+	return table->contains(string(timeStamp));
+}
+
+/*
+Method to add a time stamp to the index if it isn't already there
+*/
+bool ConcurrentTimeStampIndex::insert(string_view timeStamp) {
+	return table->insert(string(timeStamp));
+}
+
+/*
+Method to return the number of time stamps in the index
+*/
+unsigned long ConcurrentTimeStampIndex::getSize() const {
+	return table->getSize();
+}
+
+/*
+Method to remove every time stamp, the index goes back to room for a day of stamps
+*/
+void ConcurrentTimeStampIndex::clear() {
+	delete table;
+	table = new ConcurrentHashTable<string>(&comparator, &hasher, CONCURRENT_INDEX_SIZE);
+}
@@ -0,0 +1,53 @@
+#pragma once
+#ifndef CONCURRENT_TIME_STAMP_INDEX_H
+#define CONCURRENT_TIME_STAMP_INDEX_H
+
+#include <string>
+#include <string_view>
+#include "Comparator.h"
+#include "Hasher.h"
+#include "ConcurrentHashTable.h"
+
+const unsigned long CONCURRENT_INDEX_SIZE = 86400;            // stamps a new index holds before it grows, a day of seconds
+
+// ConcurrentTimeStampIndex is the TimeStampIndex used when a file is read on several threads
+// the stamps are kept in a ConcurrentHashTable, so parse workers can look stamps up without taking a lock
+// while the merge adds the stamps of the lines before theirs
+// one file holds a single date, so it has at most a day of distinct stamps and the index starts with room
+// for them rather than copying every stamp on each growth
+class ConcurrentTimeStampIndex {
+private:
+	// orders time stamps by their text
+	class TextComparator : public Comparator<std::string> {
+	public:
+		int compare(const std::string& item1, const std::string& item2) const override;
+	};
+
+	// hashes a time stamp with the same FNV-1a hash as TimeStampIndex
+	class TextHasher : public Hasher<std::string> {
+	public:
+		unsigned long hash(const std::string& item) const override;
+	};
+
+	TextComparator comparator;                                 // used by table to compare stamps
+	TextHasher hasher;                                         // used by table to hash stamps
+	ConcurrentHashTable<std::string>* table;                   // each distinct time stamp
+public:
+	ConcurrentTimeStampIndex();                                // creates an empty index
+	ConcurrentTimeStampIndex(const ConcurrentTimeStampIndex&) = delete;
+	ConcurrentTimeStampIndex& operator=(const ConcurrentTimeStampIndex&) = delete;
+	virtual ~ConcurrentTimeStampIndex();
+
+	// contains and insert can be called from several threads at once
+	// if timeStamp is present return true, otherwise return false
+	bool contains(std::string_view timeStamp) const;
+
+	// if timeStamp is not already present, add it and return true
+	// if timeStamp is already present, leave index unchanged and return false
+	bool insert(std::string_view timeStamp);
+
+	unsigned long getSize() const;                             // returns the number of time stamps in the index
+	void clear();                                              // removes every time stamp, no other thread may be using the index
+};
+
+#endif // !CONCURRENT_TIME_STAMP_INDEX_H
@@ -7,13 +7,20 @@
 #include <iomanip>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <cstring>
 #include <array>
+#include <vector>
+#include <thread>
 #include <algorithm>
 #include "ResizableArray.h"
+#include "SegmentedArray.h"
 #include "Sorter.h"
 #include "Search.h"
 #include "DrillingRecord.h"
 #include "DrillingRecordComparator.h"
+#include "DrillingRecordColumnComparator.h"
+#include "DrillingRecordKeyComparator.h"
 #include "Comparator.h"
 #include "OULink.h"
 #include "OULinkedList.h"
@@ -23,10 +30,18 @@
 #include "HashTable.h"
 #include "Hasher.h"
 #include "HashTableEnumerator.h"
+#include "OpenHashTable.h"
+#include "OpenHashTableEnumerator.h"
 #include "DrillingRecordHasher.h"
+#include "TimeStampHasher.h"
 #include "AVLTreeEnumerator.h"
 #include "AVLTree.h"
 #include "AVLTreeOrder.h"
+#include "MappedFile.h"
+#include "DrillingRecordParser.h"
+#include "TimeStampIndex.h"
+#include "ConcurrentTimeStampIndex.h"
+#include "ColumnIndex.h"
 
 using namespace std;
 
@@ -36,91 +51,284 @@ unsigned long validLinesRead = 0;
 unsigned long recordsCurrentlyStored = 0;
 string initialDateStamp = "";
 
+//selects the memory-mapped ingest path in dataInput(), the stream path is used when false or when mapping fails
+bool mappedIngest = true;
+
+//number of threads that parse a mapped file, 1 keeps ingest serial and 0 uses every hardware thread
+//ingest stays serial by default until the parallel reader is measured faster than it
+unsigned int ingestThreads = 1;
+
+//number of threads that sort mainRecordArray, 0 uses every hardware thread and 1 keeps sorting serial
+unsigned int sortThreads = 0;
+
+//how sortMethod() orders mainRecordArray, SortMode::decorated and SortMode::radix sort (key, record index)
+//pairs and move each record once, SortMode::inPlace moves the records during the sort
+SortMode sortMode = SortMode::radix;
+
+//lays out each searched column's keys for cache friendly lookups, false searches the column indexes directly
+bool staticSearch = true;
+
+//answers find and range find on numeric columns through the column indexes, false scans a copy of the
+//column instead so no index has to be built, the string columns always use the indexes
+bool indexedFind = true;
+
+//hash function mainHashTable applies to each time stamp, TimeHashFunction::asciiSum is the character sum
+//DrillingRecordHasher uses and crowds a day of time stamps into a few dozen buckets
+TimeHashFunction timeHashFunction = TimeHashFunction::seconds;
+
+//container behind mainRecordArray, SegmentedArray grows a segment at a time without moving the
+//records already stored, ResizableArray<DrillingRecord> can be put back here without other changes
+typedef SegmentedArray<DrillingRecord> RecordArray;
+
+//records are read into a tree ordered by time, the comparator type is part of the tree type so
+//the tree calls it directly instead of through Comparator<DrillingRecord>
+typedef DrillingRecordColumnComparator<1> TimeComparator;
+typedef AVLTree<DrillingRecord, TimeComparator> RecordTree;
+typedef AVLTreeEnumerator<DrillingRecord, TimeComparator> RecordTreeEnumerator;
+
+//table behind mainHashTable, OpenHashTable<DrillingRecord> and OpenHashTableEnumerator<DrillingRecord> keep
+//the records inline in Robin Hood probed slots instead of a linked list per bucket and can be put here instead
+typedef HashTable<DrillingRecord> RecordHashTable;
+typedef HashTableEnumerator<DrillingRecord> RecordHashTableEnumerator;
+
+//bytes of a mapped file handed to each ingest thread at a time
+const unsigned long INGEST_CHUNK_BYTES = 1 << 20;
+
+//a line parsed by an ingest thread, waiting to be merged into the tree
+struct ParsedRow {
+	RowParseResult result;
+	DrillingRecord record;
+};
+
 /*============================================================================================
-Function to check if the date stamp matches the correct one
+Function to print the error message for a rejected line
 */
-int checkDateStamp(string dataLine, string dateStamp, int lineNum) {
+void reportRejection(const RowParseResult& result, int lineNum) {
+
+	//prints the message matching the reason the line was rejected
+	if (result.rejection == RowRejection::badDate) {
+		std::cout << "Non-matching date stamp " << result.date << " at line " << lineNum << "." << endl;
+	}
+	else if (result.rejection == RowRejection::duplicateTime) {
+		std::cout << "Duplicate timestamp " << result.time << " at line " << lineNum << "." << endl;
+	}
+	else if (result.rejection == RowRejection::nonPositiveFloat || result.rejection == RowRejection::malformedFloat) {
+		std::cout << "Invalid floating-point data at line " << lineNum << "." << endl;
+	}
+}
+//============================================================================================
+
 
-	//creates a substring that contains only the date
-	string dateCheck = dataLine.substr(0, dataLine.find(','));
-	//checks if the substring doesn't match the correct one
-	if (dateCheck != dateStamp) {
-		//prints out the error message
-		std::cout << "Non-matching date stamp " << dateCheck << " at line " << lineNum << "." << endl;
-		return false;
+/*============================================================================================
+Function to add a parsed record to the tree if its line was valid, or report why it was rejected
+Index is TimeStampIndex for a serial read and ConcurrentTimeStampIndex for a parallel one
+*/
+template <typename Index>
+void storeOrReport(const RowParseResult& result, const DrillingRecord& record, RecordTree* mainAVLTree, Index* timeIndex, int lineNum) {
+
+	//adds the record to the tree and its time stamp to the index and increments the number of valid lines
+	if (result.rejection == RowRejection::none) {
+		mainAVLTree->insert(record);
+		timeIndex->insert(result.time);
+		validLinesRead++;
 	}
 	else {
-		return true;
+		reportRejection(result, lineNum);
+	}
+}
+//============================================================================================
+
+
+/*============================================================================================
+Function to validate one line of a data file and add it to the tree if it is valid
+*/
+void processLine(string_view line, RecordTree* mainAVLTree, TimeStampIndex* timeIndex, int lineNum) {
+
+	//sets the first date stamp to compare against
+	if (initialDateStamp == "") {
+		initialDateStamp = string(line.substr(0, line.find(',')));
+	}
+
+	//parses and validates the line in one pass, looking the time stamp up in the index
+	DrillingRecord currentRecord;
+	RowParseResult result = DrillingRecordParser::parse(line, initialDateStamp, currentRecord,
+		[timeIndex](string_view timeStamp) { return timeIndex->contains(timeStamp); });
+
+	storeOrReport(result, currentRecord, mainAVLTree, timeIndex, lineNum);
+}
+//============================================================================================
+
+
+/*============================================================================================
+Function to find the end of the line starting at cursor, the last line may not have a newline
+*/
+const char* findLineEnd(const char* cursor, const char* end) {
+	const char* lineEnd = (const char*)memchr(cursor, '\n', end - cursor);
+	return (lineEnd == nullptr) ? end : lineEnd;
+}
+//============================================================================================
+
+
+/*============================================================================================
+Function run by each ingest worker, parses every line of its chunk without touching the tree
+*/
+void parseChunk(const char* cursor, const char* end, vector<ParsedRow>* rows, const ConcurrentTimeStampIndex* timeIndex) {
+
+	//the index only holds stamps of earlier lines, so a stamp found there is a duplicate and the line's values
+	//needn't be parsed, a stamp the merge hasn't added yet is missed here and caught by the merge
+	auto isDuplicate = [timeIndex](string_view timeStamp) { return timeIndex->contains(timeStamp); };
+
+	//parses each line of the chunk in order
+	while (cursor < end) {
+		const char* lineEnd = findLineEnd(cursor, end);
+		rows->emplace_back();
+		ParsedRow& row = rows->back();
+		row.result = DrillingRecordParser::parse(string_view(cursor, lineEnd - cursor), initialDateStamp, row.record, isDuplicate);
+		cursor = lineEnd + 1;
 	}
+}
+//============================================================================================
+
 
+/*============================================================================================
+Function to start a worker on each of the next threadCount chunks of a mapped file, returns where the
+next round starts
+*/
+const char* startRound(const char* cursor, const char* end, unsigned int threadCount, vector<vector<ParsedRow>>& chunkRows,
+	vector<thread>& workers, const ConcurrentTimeStampIndex* timeIndex) {
+
+	for (unsigned int i = 0; i < threadCount && cursor < end; i++) {
+		const char* chunkEnd = (end - cursor > (ptrdiff_t)INGEST_CHUNK_BYTES) ? findLineEnd(cursor + INGEST_CHUNK_BYTES, end) : end;
+		chunkEnd = (chunkEnd < end) ? chunkEnd + 1 : end;
+		chunkRows[i].clear();
+		workers.emplace_back(parseChunk, cursor, chunkEnd, &chunkRows[i], timeIndex);
+		cursor = chunkEnd;
+	}
+	return cursor;
 }
 //============================================================================================
 
 
 /*============================================================================================
-Function to check if the time stamp is unique
+Function to read a mapped file on several threads, chunks are parsed in parallel and then merged
+into the tree in file order so duplicates and line numbers come out exactly as in a serial read
+Each round is merged while the workers parse the next one, and they check their stamps against the
+index the merge is adding to
 */
-bool checkTimeStamp(string dataLine, AVLTree<DrillingRecord>* AVLTree, int lineNum) {
+void readMappedFileParallel(const char* cursor, const char* end, unsigned int threadCount, RecordTree* mainAVLTree, ConcurrentTimeStampIndex* timeIndex) {
 
-	//makes a substring of everything except the date
-	string dataLineMinusDate = dataLine.substr(dataLine.find(',') + 1);
+	//variable to keep track of current file line being used
+	int fileLineNum = 1;
 
-	//makes a substring of the time stamp
-	string timeStampToCheck = dataLineMinusDate.substr(0, dataLineMinusDate.find(','));
+	//the first date stamp has to be known before any worker checks dates against it
+	if (initialDateStamp == "" && cursor < end) {
+		string_view firstLine(cursor, findLineEnd(cursor, end) - cursor);
+		initialDateStamp = string(firstLine.substr(0, firstLine.find(',')));
+	}
 
-	//drilling record to store the time to check
-	DrillingRecord* temp = new DrillingRecord();
-	temp->setString(timeStampToCheck, 1);
+	//two sets of row buffers, one per worker each, the round being merged and the round being parsed
+	//alternate between them so only a bounded part of the file is held parsed
+	vector<vector<ParsedRow>> roundRows[2] = { vector<vector<ParsedRow>>(threadCount), vector<vector<ParsedRow>>(threadCount) };
+	vector<thread> workers;
+	unsigned int round = 0;
+	cursor = startRound(cursor, end, threadCount, roundRows[0], workers, timeIndex);
 
-	//iterates through the given tree to check for matching time stamps
-	for (unsigned int i = 0; i < AVLTree->getSize(); i++) {
+	//each round hands one newline aligned chunk to each worker
+	while (!workers.empty()) {
 
-		//checks if time stamp equals one from array and prints error message if so
-		if (AVLTree->contains(*temp)) {
-			std::cout << "Duplicate timestamp " << timeStampToCheck << " at line " << lineNum << "." << endl;
-			delete temp;
-			temp = nullptr;
-			return false;
+		//waits for the round to finish
+		for (unsigned int i = 0; i < workers.size(); i++) {
+			workers[i].join();
 		}
+		unsigned int chunkCount = (unsigned int)workers.size();
+		workers.clear();
+
+		//starts the next round before merging this one
+		vector<vector<ParsedRow>>& chunkRows = roundRows[round % 2];
+		cursor = startRound(cursor, end, threadCount, roundRows[(round + 1) % 2], workers, timeIndex);
+
+		//merges the chunks in order, checking each time stamp against everything before it
+		for (unsigned int i = 0; i < chunkCount; i++) {
+			for (unsigned long j = 0; j < chunkRows[i].size(); j++) {
+				ParsedRow& row = chunkRows[i][j];
+
+				//a duplicate time stamp is reported ahead of bad values, as in a serial read, stamps the
+				//workers found in the index are already marked
+				if (row.result.rejection != RowRejection::badDate && row.result.rejection != RowRejection::duplicateTime &&
+					timeIndex->contains(row.result.time)) {
+					row.result.rejection = RowRejection::duplicateTime;
+				}
+				storeOrReport(row.result, row.record, mainAVLTree, timeIndex, fileLineNum);
+
+				//increases the line number
+				fileLineNum++;
+				totalLinesRead++;
+			}
+		}
+		round++;
+	}
+}
+//============================================================================================
+
+
+/*============================================================================================
+Function to read every line of a mapped file, lines are viewed in place inside the mapping
+*/
+void readMappedFile(const MappedFile& mappedFile, RecordTree* mainAVLTree, TimeStampIndex* timeIndex) {
+
+	//variable to keep track of current file line being used
+	int fileLineNum = 1;
+	const char* cursor = mappedFile.getData();
+	const char* end = cursor + mappedFile.getSize();
+
+	//skips the header line
+	cursor = findLineEnd(cursor, end);
+	cursor = (cursor < end) ? cursor + 1 : end;
+
+	//hands the file to the parallel reader when more than one ingest thread is wanted, its workers read the
+	//index while the merge adds to it so it uses a concurrent one, dataInput reads each file into a new tree
+	//and nothing reads timeIndex after the file, so it is left empty
+	unsigned int threadCount = (ingestThreads == 0) ? thread::hardware_concurrency() : ingestThreads;
+	if (threadCount > 1) {
+		ConcurrentTimeStampIndex concurrentIndex;
+		readMappedFileParallel(cursor, end, threadCount, mainAVLTree, &concurrentIndex);
+		return;
 	}
-	//deletes objects
-	delete temp;
-	temp = nullptr;
-	return true;
 
+	//loop to iterate through the mapping one line at a time
+	while (cursor < end) {
+		const char* lineEnd = findLineEnd(cursor, end);
+		processLine(string_view(cursor, lineEnd - cursor), mainAVLTree, timeIndex, fileLineNum);
+		cursor = lineEnd + 1;
+
+		//increases the line number
+		fileLineNum++;
+		totalLinesRead++;
+	}
 }
 //============================================================================================
 
 
 /*============================================================================================
-Function to check that all the float values are positive
+Function to read every line of a file through a stream, used when the file cannot be mapped
 */
-bool checkFloatValues(string dataLine, int lineNum) {
-	//declare variables
-	string tempData;
-	double doubleData;
+void readStreamFile(ifstream& fileName, RecordTree* mainAVLTree, TimeStampIndex* timeIndex) {
 
-	//turn input string into a stringstream
-	stringstream stringData(dataLine);
+	//variable to keep track of current file line being used
+	int fileLineNum = 1;
 
-	//ignores the date and time stamps
-	stringData.ignore(256, ',');
-	stringData.ignore(256, ',');
+	//declares variable to store file line in and then skips the first line
+	string line = "";
+	fileName.ignore(10000, '\n');
 
-	//iterates through each data point checking
-	for (int i = 0; i < 16; i++) {
-		//splits each piece of data off from the stringstream and turns it into a double
-		getline(stringData, tempData, ',');
-		doubleData = stod(tempData);
+	//loop to iterate through file collecting data
+	while (getline(fileName, line)) {
+		processLine(line, mainAVLTree, timeIndex, fileLineNum);
 
-		//checks if the data is positive and throws an error otherwise
-		if (doubleData <= 0) {
-			std::cout << "Invalid floating-point data at line " << lineNum << "." << endl;
-			return false;
-		}
+		//increases the line number
+		fileLineNum++;
+		totalLinesRead++;
 	}
-	//returns true if all the data values are positive
-	return true;
 }
 //============================================================================================
 
@@ -128,7 +336,7 @@ bool checkFloatValues(string dataLine, int lineNum) {
 /*============================================================================================
 Method to output the data using the resizable array
 */
-void dataOutput(ResizableArray<DrillingRecord>* mainRecordArray) {
+void dataOutput(RecordArray* mainRecordArray) {
 
 	//priming read for the loop to get the output file name
 	string outputFileName = "";
@@ -148,7 +356,7 @@ void dataOutput(ResizableArray<DrillingRecord>* mainRecordArray) {
 
 				//try/catch block to catch an IndexOutOfRange exception
 				try {
-					std::cout << mainRecordArray->get(i) << endl;
+					std::cout << mainRecordArray->at(i) << endl;
 
 				}
 				catch (ExceptionIndexOutOfRange* e) {
@@ -173,7 +381,7 @@ void dataOutput(ResizableArray<DrillingRecord>* mainRecordArray) {
 				//loops through and prints out each record to the file
 				for (unsigned long i = 0; i < recordsCurrentlyStored; i++) {
 					try {
-						outputToFile << mainRecordArray->get(i) << endl;
+						outputToFile << mainRecordArray->at(i) << endl;
 					}
 					catch (ExceptionIndexOutOfRange* e) {
 						delete e;
@@ -194,20 +402,65 @@ void dataOutput(ResizableArray<DrillingRecord>* mainRecordArray) {
 /*============================================================================================
 Method to sort the data
 */
-unsigned int sortMethod(ResizableArray<DrillingRecord>* mainRecordArray, unsigned int sortColumn) {
+void sortMethod(RecordArray* mainRecordArray, ColumnIndex<RecordArray>* columnIndex) {
 	//asks the user which field to sort on and converts it to an int
 	string sortField = "";
 	std::cout << "Enter sort field (0-17): " << endl;
 	getline(cin, sortField, '\n');
 	unsigned int column = (unsigned)stoi(sortField);
 
-	//makes sure it is valid and if so sorts based on that column
+	//makes sure it is valid and if so sorts based on that column, which moves the records the indexes point at
 	if (column <= 17) {
-		sortColumn = column;
-		DrillingRecordComparator sortComp(column);
-		Sorter<DrillingRecord>::sort(*mainRecordArray, sortComp);
+		withColumnComparator(column, [&](const auto& sortComp) {
+			Sorter<DrillingRecord>::sort(*mainRecordArray, sortComp, sortThreads, sortMode);
+		});
+		columnIndex->invalidate();
+	}
+}
+//============================================================================================
+
+
+
+/*============================================================================================
+Function to print the records in a range of a column view, and how many there are
+*/
+void printRange(const ColumnView<RecordArray>& columnView, SearchRange range) {
+
+	//prints each record in the range in column order
+	for (unsigned long i = range.first; i < range.last; i++) {
+		cout << columnView.getUnchecked(i) << endl;
+	}
+
+	//prints out total number of matching records found
+	cout << "Drilling records found: " << range.getCount() << "." << endl;
+}
+//============================================================================================
+
+
+/*============================================================================================
+Function to print the records at the given array positions, and how many there are
+*/
+void printRows(RecordArray* mainRecordArray, const ResizableArray<unsigned long>& rows) {
+
+	//prints each record in array order
+	for (unsigned long i = 0; i < rows.getSize(); i++) {
+		cout << mainRecordArray->getUnchecked(rows.getUnchecked(i)) << endl;
 	}
-	return sortColumn;
+
+	//prints out total number of matching records found
+	cout << "Drilling records found: " << rows.getSize() << "." << endl;
+}
+//============================================================================================
+
+
+/*============================================================================================
+Function to print every record whose column matches the search record, and how many there are
+*/
+void printMatches(const DrillingRecord& searchRecord, ColumnIndex<RecordArray>* columnIndex, unsigned int column) {
+
+	//the matches are together in column order, between the two bounds of the search record
+	SearchRange range = columnIndex->equalRange(column, searchRecord);
+	printRange(columnIndex->view(column), range);
 }
 //============================================================================================
 
@@ -216,7 +469,7 @@ unsigned int sortMethod(ResizableArray<DrillingRecord>* mainRecordArray, unsigne
 /*============================================================================================
 Method to search through the data
 */
-void searchMethod(ResizableArray<DrillingRecord>* mainRecordArray, HashTable<DrillingRecord>* mainHashTable, unsigned int sortColumn) {
+void searchMethod(RecordArray* mainRecordArray, ColumnIndex<RecordArray>* columnIndex, RecordHashTable* mainHashTable) {
 
 	//asks the user which field to sort on and converts it to an int
 	string searchField = "";
@@ -252,44 +505,15 @@ void searchMethod(ResizableArray<DrillingRecord>* mainRecordArray, HashTable<Dri
 					}
 
 
-					//creates comparator for the search
-					Comparator<DrillingRecord>* searchComp = new DrillingRecordComparator(column);
-					long long index;
-					long long location = 0;
-
-					//checks if the column entered is the same column as the column
-					//sorted on and calls correct search
-					if (sortColumn == column) {
-						index = binarySearch(*searchRecord, *mainRecordArray, *searchComp);
+					//searches the column's index, which holds every matching record together and in array order,
+					//or scans the column's values
+					if (indexedFind) {
+						printMatches(*searchRecord, columnIndex, column);
 					}
 					else {
-						index = linearSearch(*searchRecord, *mainRecordArray, *searchComp);
-					}
-
-					location = index;
-					int numMatches = 0;
-
-					//if the search key is in the array then it iterates through, finding all records with a matching value
-					if (index >= 0) {
-						while ((unsigned)index < mainRecordArray->getSize()) {
-
-							if (searchComp->compare(mainRecordArray->get((unsigned long)index), mainRecordArray->get((unsigned long)location)) == 0) {
-								try {
-									cout << mainRecordArray->get((unsigned long)index) << endl;
-									numMatches++;
-								}
-								catch (ExceptionIndexOutOfRange* e) {
-									delete e;
-								}
-							}
-
-							index++;
-						}
-						//prints out total number of matching records found
-						cout << "Drilling records found: " << numMatches << "." << endl;
-					}
-					else {
-						cout << "Drilling records found: 0." << endl;
+						ResizableArray<unsigned long> rows;
+						columnIndex->scan(column, ScanComparison::equal, keyValue, keyValue, rows);
+						printRows(mainRecordArray, rows);
 					}
 
 					//deletes objects
@@ -317,15 +541,10 @@ void searchMethod(ResizableArray<DrillingRecord>* mainRecordArray, HashTable<Dri
 					delete e;
 				}
 
-				//creates comparator for the search
-				Comparator<DrillingRecord>* searchComp = new DrillingRecordComparator(column);
-				long long index;
-				long long location;
-
-				//if column to search on is time stamp, hash
+				//if column to search on is time stamp, hash, the table looks the text up without a record
 				if (column == 1) {
 					try {
-						cout << mainHashTable->find(*searchRecord) << endl;
+						cout << mainHashTable->findKey(string_view(fieldValue)) << endl;
 					}
 					catch (ExceptionHashTableAccess* e) {
 						cout << "Drilling records found: 0." << endl;
@@ -333,39 +552,8 @@ void searchMethod(ResizableArray<DrillingRecord>* mainRecordArray, HashTable<Dri
 					}
 				}
 
-				//checks if the column entered is the same column as the column
-				//sorted on and calls correct search
-				if (sortColumn == column) {
-					index = binarySearch(*searchRecord, *mainRecordArray, *searchComp);
-				}
-				else {
-					index = linearSearch(*searchRecord, *mainRecordArray, *searchComp);
-				}
-
-				location = index;
-				int numMatches = 0;
-				//iterates through array if search returns a nonnegative printing out matches
-				if (index >= 0) {
-					while ((unsigned)index < mainRecordArray->getSize()) {
-
-						if (searchComp->compare(mainRecordArray->get((unsigned long)index), mainRecordArray->get((unsigned long)location)) == 0) {
-							try {
-								cout << mainRecordArray->get((unsigned long)index) << endl;
-								numMatches++;
-							}
-							catch (ExceptionIndexOutOfRange* e) {
-								delete e;
-							}
-						}
-
-						index++;
-					}
-					//prints out total number of matches found
-					cout << "Drilling records found: " << numMatches << "." << endl;
-				}
-				else {
-					cout << "Drilling records found: 0." << endl;
-				}
+				//searches the column's index, which holds every matching record together and in array order
+				printMatches(*searchRecord, columnIndex, column);
 
 				//deletes objects
 				delete searchRecord;
@@ -379,10 +567,83 @@ void searchMethod(ResizableArray<DrillingRecord>* mainRecordArray, HashTable<Dri
 
 
 
+/*============================================================================================
+Method to find every record with a column value in a range, a time window for the time stamp
+or a low and high value for a numeric column
+*/
+void rangeMethod(RecordArray* mainRecordArray, ColumnIndex<RecordArray>* columnIndex) {
+
+	//asks the user which field to search on and converts it to an int
+	string searchField = "";
+	std::cout << "Enter search field (1-17): ";
+	getline(cin, searchField, '\n');
+	unsigned int column = (unsigned)stoi(searchField);
+
+	//the date stamp is the same in every record so only the other columns have ranges
+	if (column < 1 || column > 17) {
+		return;
+	}
+
+	//asks for both ends of the range, a time window for the time stamp and values otherwise
+	string lowValue = "";
+	string highValue = "";
+	if (column == 1) {
+		std::cout << "Enter start time: ";
+		getline(cin, lowValue, '\n');
+		std::cout << "Enter end time: ";
+		getline(cin, highValue, '\n');
+	}
+	else {
+		std::cout << "Enter low field value: ";
+		getline(cin, lowValue, '\n');
+		std::cout << "Enter high field value: ";
+		getline(cin, highValue, '\n');
+	}
+
+	//checks if the user entered both ends
+	if (lowValue == "" || highValue == "") {
+		return;
+	}
+
+	//both ends of a numeric range have to be numbers
+	double lowNum = 0;
+	double highNum = 0;
+	if (column > 1 && (!DrillingRecordParser::parseDouble(lowValue, lowNum) || !DrillingRecordParser::parseDouble(highValue, highNum))) {
+		return;
+	}
+
+	//scans the column's values for a numeric range when finds don't use the indexes, printing in array order
+	if (column > 1 && !indexedFind) {
+		ResizableArray<unsigned long> rows;
+		columnIndex->scan(column, ScanComparison::between, lowNum, highNum, rows);
+		printRows(mainRecordArray, rows);
+		return;
+	}
+
+	//sets each end of the range into the searched column of a record
+	DrillingRecord lowRecord;
+	DrillingRecord highRecord;
+	if (column == 1) {
+		lowRecord.setString(lowValue, column);
+		highRecord.setString(highValue, column);
+	}
+	else {
+		lowRecord.setNum(lowNum, column - 2);
+		highRecord.setNum(highNum, column - 2);
+	}
+
+	//finds both ends in the column's index, everything between them is in the range
+	SearchRange range = columnIndex->rangeSearch(column, lowRecord, highRecord);
+	printRange(columnIndex->view(column), range);
+}
+//============================================================================================
+
+
+
 /*============================================================================================
  Method to read in new files
 */
-AVLTree<DrillingRecord>* dataInput() {
+RecordTree* dataInput() {
 
 	ifstream fileName;
 	string userInput = "";
@@ -392,19 +653,24 @@ AVLTree<DrillingRecord>* dataInput() {
 	getline(cin, userInput, '\n');
 
 	//tree to read data into
-	Comparator<DrillingRecord>* newComp = new DrillingRecordComparator(1);
-	AVLTree<DrillingRecord>* mainAVLTree = new AVLTree<DrillingRecord>(newComp);
-	
+	TimeComparator* newComp = new TimeComparator();
+	RecordTree* mainAVLTree = new RecordTree(newComp);
+
+	//index of the time stamps in the tree, used to find duplicates with a single lookup per line
+	TimeStampIndex timeIndex;
 
 	//loop to read in file from the user
 	while (mainAVLTree->getSize() == 0 && !userInput.empty()) {
 
-		//variable to keep track of current file line being used
-		int fileLineNum = 1;
+		//maps the file if mapped ingest is on, otherwise or if that fails opens it as a stream
+		MappedFile mappedFile;
+		bool mapped = mappedIngest && mappedFile.open(userInput);
+		if (!mapped) {
+			fileName.open(userInput, ifstream::in);
+		}
 
-		//attempts to open the file and tells the user if that fails
-		fileName.open(userInput, ifstream::in);
-		if (!fileName.is_open()) {
+		//tells the user if the file could not be opened
+		if (!mapped && !fileName.is_open()) {
 			std::cout << "File is not available." << endl;
 
 			//repeats prompt for input
@@ -414,67 +680,20 @@ AVLTree<DrillingRecord>* dataInput() {
 			continue;
 		}
 
-		//declares variable to store file line in and then skips the first line
-		string line = "";
-		fileName.ignore(10000, '\n');
-
-		//loop to iterate through file collecting data
-		while (getline(fileName, line)) {
-
-			//sets the first date stamp to compare against
-			if (initialDateStamp == "") {
-				initialDateStamp = line.substr(0, line.find(','));
-			}
-			//calls the checkDateStamp function to ensure date stamps are correct
-			if (checkDateStamp(line, initialDateStamp, fileLineNum)) {
-
-				//calls the checkFloatValues function to ensure they are positive are unique
-				if (checkTimeStamp(line, mainAVLTree, fileLineNum)) {
-
-					//calls the checkFloatValues method to ensure they are positive
-					if (checkFloatValues(line, fileLineNum)) {
-
-						//declares a drilling record to use and a string stream
-						DrillingRecord currentRecord;
-
-						//pulls off datestamp and puts it in correct array
-						string dateStamp = line.substr(0, line.find(','));
-						currentRecord.addString(dateStamp);
-
-						//pulls off timestamp and puts it in correct array
-						string noDateStamp = line.substr(line.find(',') + 1);
-						string timeStamp = noDateStamp.substr(0, noDateStamp.find(','));
-						currentRecord.addString(timeStamp);
-
-						string noTimeStamp = noDateStamp.substr(noDateStamp.find(',') + 1);
-						stringstream noStrings(noTimeStamp);
-
-						//splices off each piece of data, turns it to a double, and then puts it into the correct array
-						for (int i = 0; i < 16; i++) {
-							string tempData = "";
-							getline(noStrings, tempData, ',');
-							double doubleData = stod(tempData);
-							currentRecord.addNum(doubleData);
-
-						}
-						
-						//adds the current drilling record to the tree and increments the number of valid lines
-						mainAVLTree->insert(currentRecord);
-						validLinesRead++;
-
-					}
-				}
-			}
-			//increases the line number
-			fileLineNum++;
-			totalLinesRead++;
+		//reads every line of the file into the tree
+		if (mapped) {
+			readMappedFile(mappedFile, mainAVLTree, &timeIndex);
+		}
+		else {
+			readStreamFile(fileName, mainAVLTree, &timeIndex);
 		}
 
 		//update the value of the recordscurrentlystored variable
 		recordsCurrentlyStored = mainAVLTree->getSize();
 
-		//close filestream
+		//close filestream and mapping
 		fileName.close();
+		mappedFile.close();
 
 		//if tree size is 0 then no valid data was read
 		if (mainAVLTree->getSize() == 0) {
@@ -494,13 +713,13 @@ AVLTree<DrillingRecord>* dataInput() {
 /*============================================================================================
 Merge method, reads in new file and replaces any duplicates
 */
-void mergeMethod(AVLTree<DrillingRecord>* mainAVLTree, ResizableArray<DrillingRecord>* mainRecordArray, HashTable<DrillingRecord>* mainHashTable) {
+void mergeMethod(RecordTree* mainAVLTree, RecordArray* mainRecordArray, ColumnIndex<RecordArray>* columnIndex, RecordHashTable* mainHashTable) {
 
 	//creates a new tree and reads file into that tree
-	AVLTree<DrillingRecord>* tempTree = dataInput();
+	RecordTree* tempTree = dataInput();
 
 	//creates an enum to iterate through the tree with
-	AVLTreeEnumerator<DrillingRecord> tempEnum = tempTree->enumerator();
+	RecordTreeEnumerator tempEnum = tempTree->enumerator();
 
 	//loops until there is no next element
 	while (tempEnum.hasNext()) {
@@ -522,33 +741,35 @@ void mergeMethod(AVLTree<DrillingRecord>* mainAVLTree, ResizableArray<DrillingRe
 		}
 	}
 
-	//loop to clear the array
+	//loop to clear the array, the indexes point at the records being cleared
 	mainRecordArray->clear();
+	columnIndex->invalidate();
 
 	//creates new comparator and hasher for hash table
-	Comparator<DrillingRecord>* newComp = new DrillingRecordComparator(1);
-	Hasher<DrillingRecord>* newHash = new DrillingRecordHasher();
+	Comparator<DrillingRecord>* newComp = new DrillingRecordKeyComparator(1);
+	Hasher<DrillingRecord>* newHash = new TimeStampHasher(timeHashFunction);
 
 	//deletes old hash table
 	delete mainHashTable;
 
 	//reassigns main hash table
-	mainHashTable = new HashTable<DrillingRecord>(newComp, newHash, mainAVLTree->getSize());
+	mainHashTable = new RecordHashTable(newComp, newHash, mainAVLTree->getSize());
 
 	//enum to iterate through main tree
-	AVLTreeEnumerator<DrillingRecord> enum2 = mainAVLTree->enumerator();
+	RecordTreeEnumerator enum2 = mainAVLTree->enumerator();
 
-	//loops through and adds every item in the tree into the array and the hash table
+	//loops through and adds every item in the tree into the pre-sized array and the hash table
+	mainRecordArray->reserve(mainAVLTree->getSize());
 	while (enum2.hasNext()) {
 		DrillingRecord current = enum2.next();
-		mainRecordArray->add(current);
 		mainHashTable->insert(current);
+		mainRecordArray->add(std::move(current));
 	}
 
 
 	//sorts array based on time
-	DrillingRecordComparator sortComp(1);
-	Sorter<DrillingRecord>::sort(*mainRecordArray, sortComp);
+	TimeComparator sortComp;
+	Sorter<DrillingRecord>::sort(*mainRecordArray, sortComp, sortThreads);
 
 	//updates the variable
 	recordsCurrentlyStored = mainAVLTree->getSize();
@@ -566,13 +787,13 @@ void mergeMethod(AVLTree<DrillingRecord>* mainAVLTree, ResizableArray<DrillingRe
 /*============================================================================================
 Purge method, reads in new file and deletes any duplicates
 */
-void purgeMethod(AVLTree<DrillingRecord>* mainAVLTree, ResizableArray<DrillingRecord>* mainRecordArray, HashTable<DrillingRecord>* mainHashTable) {
+void purgeMethod(RecordTree* mainAVLTree, RecordArray* mainRecordArray, ColumnIndex<RecordArray>* columnIndex, RecordHashTable* mainHashTable) {
 
 	//creates a new tree and reads into that tree
-	AVLTree<DrillingRecord>* tempTree = dataInput();
+	RecordTree* tempTree = dataInput();
 
 	//enum to iterate through tree with
-	AVLTreeEnumerator<DrillingRecord> tempEnum = tempTree->enumerator();
+	RecordTreeEnumerator tempEnum = tempTree->enumerator();
 
 	//loops until there is no next element
 	while (tempEnum.hasNext()) {
@@ -596,35 +817,37 @@ void purgeMethod(AVLTree<DrillingRecord>* mainAVLTree, ResizableArray<DrillingRe
 
 	if (mainAVLTree->getSize() > 0) {
 
-		//loop to clear the array
+		//loop to clear the array, the indexes point at the records being cleared
 		mainRecordArray->clear();
+		columnIndex->invalidate();
 
 		//deletes hash table
 		delete mainHashTable;
 
 		//creates a new hash table
-		Comparator<DrillingRecord>* newComp = new DrillingRecordComparator(1);
-		Hasher<DrillingRecord>* newHasher = new DrillingRecordHasher();
+		Comparator<DrillingRecord>* newComp = new DrillingRecordKeyComparator(1);
+		Hasher<DrillingRecord>* newHasher = new TimeStampHasher(timeHashFunction);
 
 		//reassigns hash table
-		mainHashTable = new HashTable<DrillingRecord>(newComp, newHasher, mainAVLTree->getSize());
+		mainHashTable = new RecordHashTable(newComp, newHasher, mainAVLTree->getSize());
 
 		//enum to iterate through main tree
-		AVLTreeEnumerator<DrillingRecord> enum2 = mainAVLTree->enumerator();
+		RecordTreeEnumerator enum2 = mainAVLTree->enumerator();
 
-		//loops through and adds every item in the tree into the array and hash table
+		//loops through and adds every item in the tree into the pre-sized array and hash table
+		mainRecordArray->reserve(mainAVLTree->getSize());
 		while (enum2.hasNext()) {
 			DrillingRecord current = enum2.next();
-			mainRecordArray->add(current);
 			mainHashTable->insert(current);
+			mainRecordArray->add(std::move(current));
 		}
 	}
 
 
 	//sorts the array based on time if the array is not empty
 	if (mainRecordArray->getSize() > 0) {
-		DrillingRecordComparator sortComp(1);
-		Sorter<DrillingRecord>::sort(*mainRecordArray, sortComp);
+		TimeComparator sortComp;
+		Sorter<DrillingRecord>::sort(*mainRecordArray, sortComp, sortThreads);
 	}
 
 	//updates the variable
@@ -718,7 +941,7 @@ Method to output data using the linked list
 /*============================================================================================
 Method to output data from the hash table
 */
-void hashOutput(HashTable<DrillingRecord>* mainHashTable) {
+void hashOutput(RecordHashTable* mainHashTable) {
 
 	string outputFileName = "";
 	cout << "Enter output file name: ";
@@ -727,9 +950,10 @@ void hashOutput(HashTable<DrillingRecord>* mainHashTable) {
 	bool printed = false;
 	bool firstBucketList = true;
 
-	HashTableEnumerator<DrillingRecord>* outputEnum = new HashTableEnumerator<DrillingRecord>(mainHashTable);
+	RecordHashTableEnumerator* outputEnum = new RecordHashTableEnumerator(mainHashTable);
 	DrillingRecord current;
 	DrillingRecord previous;
+	HashTableStatistics statistics = mainHashTable->getStatistics();
 
 	//iterates until loop is printed
 	while (printed == false) {
@@ -768,6 +992,7 @@ void hashOutput(HashTable<DrillingRecord>* mainHashTable) {
 			}
 			cout << endl;
 			cout << "Base Capacity: " << mainHashTable->getBaseCapacity() << "; Total Capacity: " << mainHashTable->getTotalCapacity() << "; Load Factor: " << mainHashTable->getLoadFactor() << endl;
+			cout << "Used Buckets: " << statistics.usedBuckets << "; Longest Chain: " << statistics.longestChain << "; Chain Variance: " << statistics.chainVariance << endl;
 			cout << "Data lines read: " << totalLinesRead << "; Valid Drilling records read: " << validLinesRead << "; Drilling records in memory: " << recordsCurrentlyStored << endl;
 			printed = true;
 		}
@@ -815,6 +1040,7 @@ void hashOutput(HashTable<DrillingRecord>* mainHashTable) {
 				}
 				outputFileStream << endl;
 				outputFileStream << "Base Capacity: " << mainHashTable->getBaseCapacity() << "; Total Capacity: " << mainHashTable->getTotalCapacity() << "; Load Factor: " << mainHashTable->getLoadFactor() << endl;
+				outputFileStream << "Used Buckets: " << statistics.usedBuckets << "; Longest Chain: " << statistics.longestChain << "; Chain Variance: " << statistics.chainVariance << endl;
 				outputFileStream << "Data lines read: " << totalLinesRead << "; Valid Drilling records read: " << validLinesRead << "; Drilling records in memory: " << recordsCurrentlyStored << endl;
 				printed = true;
 			}
@@ -828,7 +1054,7 @@ void hashOutput(HashTable<DrillingRecord>* mainHashTable) {
 /*============================================================================================
 Method to output data from the AVL tree
 */
-void treeOutput(AVLTree<DrillingRecord>* mainAVLTree, AVLTreeOrder order) {
+void treeOutput(RecordTree* mainAVLTree, AVLTreeOrder order) {
 
 	string outputFileName = "";
 	cout << "Enter output file name: ";
@@ -836,7 +1062,7 @@ void treeOutput(AVLTree<DrillingRecord>* mainAVLTree, AVLTreeOrder order) {
 	ofstream outputFileStream;
 	bool printed = false;
 
-	AVLTreeEnumerator<DrillingRecord> outputEnum = mainAVLTree->enumerator(order);
+	RecordTreeEnumerator outputEnum = mainAVLTree->enumerator(order);
 
 	//iterates until loop is printed
 	while (printed == false) {
@@ -899,20 +1125,16 @@ int main()
 	string userInput = "";
 	ifstream fileName;
 
-	//declares ResizableArray object to use
-	ResizableArray<DrillingRecord>* mainRecordArray = new ResizableArray<DrillingRecord>;
+	//declares the record array to use
+	RecordArray* mainRecordArray = new RecordArray;
 
 	//creates main AVL tree for the program and reads into it
-	AVLTree<DrillingRecord>* mainAVLTree = dataInput();
-
-	//creates an enumerator to loop through the tree and add the records to the array
-	AVLTreeEnumerator<DrillingRecord> tempEnum = mainAVLTree->enumerator();
+	RecordTree* mainAVLTree = dataInput();
 
-	//loops through and adds every item in the tree into the array
-	while (tempEnum.hasNext()) {
-		DrillingRecord current = tempEnum.next();
-		mainRecordArray->add(current);
-	}
+	//creates an enumerator to loop through the tree and adds every record to the array in one pre-sized fill
+	RecordTreeEnumerator tempEnum = mainAVLTree->enumerator();
+	mainRecordArray->reserve(mainAVLTree->getSize());
+	mainRecordArray->addAll(tempEnum);
 
 	//if tree is empty, exit the program
 	if (mainAVLTree->getSize() == 0) {
@@ -920,9 +1142,9 @@ int main()
 	}
 
 	//creates a hash table to store data in
-	Comparator<DrillingRecord>* hashComp = new DrillingRecordComparator(1);
-	Hasher<DrillingRecord>* hasher = new DrillingRecordHasher();
-	HashTable<DrillingRecord>* mainHashTable = new HashTable<DrillingRecord>(hashComp, hasher, mainAVLTree->getSize());
+	Comparator<DrillingRecord>* hashComp = new DrillingRecordKeyComparator(1);
+	Hasher<DrillingRecord>* hasher = new TimeStampHasher(timeHashFunction);
+	RecordHashTable* mainHashTable = new RecordHashTable(hashComp, hasher, mainAVLTree->getSize());
 	tempEnum = mainAVLTree->enumerator();
 
 	//loops through the tree hashing each item
@@ -932,16 +1154,15 @@ int main()
 	}
 
 	//sorts the array based on time
-	DrillingRecordComparator sortComp(1);
-	Sorter<DrillingRecord>::sort(*mainRecordArray, sortComp);
+	TimeComparator sortComp;
+	Sorter<DrillingRecord>::sort(*mainRecordArray, sortComp, sortThreads);
 
 	//priming read for the main loop 
-	cout << "Enter (o)utput, (s)ort, (f)ind, (m)erge, (p)urge, (h)ash table, (pre)order, (in)order, (post)order, or (q)uit: ";
+	cout << "Enter (o)utput, (s)ort, (f)ind, (r)ange find, (m)erge, (p)urge, (h)ash table, (pre)order, (in)order, (post)order, or (q)uit: ";
 	getline(cin, userInput, '\n');
 
-	//column to keep track of which column the array of data is sorted
-	//initialized to the time stamp since that is the default
-	unsigned int sortColumn = 1;
+	//sorted order of the array by each column that is searched, built on the first search of a column
+	ColumnIndex<RecordArray>* columnIndex = new ColumnIndex<RecordArray>(mainRecordArray, sortThreads, staticSearch);
 
 	/*
 	Main data loop, asks users whether they would like output, sort, find, merge, purge, records, or quit
@@ -955,22 +1176,27 @@ int main()
 
 		//method call for if the user enters an s
 		if (userInput == "s" || userInput == "S") {
-			sortColumn = sortMethod(mainRecordArray, sortColumn);
+			sortMethod(mainRecordArray, columnIndex);
 		}
 
 		//method call for if the user enters an f
 		if (userInput == "f" || userInput == "F") {
-			searchMethod(mainRecordArray, mainHashTable, sortColumn);
+			searchMethod(mainRecordArray, columnIndex, mainHashTable);
+		}
+
+		//method call for if the user enters an r
+		if (userInput == "r" || userInput == "R") {
+			rangeMethod(mainRecordArray, columnIndex);
 		}
 
 		//method call for if the user enters an m
 		if (userInput == "m" || userInput == "M") {
-			mergeMethod(mainAVLTree, mainRecordArray, mainHashTable);
+			mergeMethod(mainAVLTree, mainRecordArray, columnIndex, mainHashTable);
 		}
 
 		//method call for if the user enters a p
 		if (userInput == "p" || userInput == "P") {
-			purgeMethod(mainAVLTree, mainRecordArray, mainHashTable);
+			purgeMethod(mainAVLTree, mainRecordArray, columnIndex, mainHashTable);
 		}
 
 		//method call for if the user enters an h
@@ -994,16 +1220,18 @@ int main()
 		}
 
 		//gets user input for next pass through the loop 
-		cout << "Enter (o)utput, (s)ort, (f)ind, (m)erge, (p)urge, (h)ash table, (pre)order, (in)order, (post)order, or (q)uit: ";
+		cout << "Enter (o)utput, (s)ort, (f)ind, (r)ange find, (m)erge, (p)urge, (h)ash table, (pre)order, (in)order, (post)order, or (q)uit: ";
 		getline(cin, userInput, '\n');
 	}
 
 	//prints a farewell if user hits quit
 	cout << "Thanks for using Driller." << endl;
 
-	//deletes AVL tree, resizable array, and hash table
+	//deletes AVL tree, column indexes, resizable array, and hash table
 	delete mainAVLTree;
 	mainAVLTree = nullptr;
+	delete columnIndex;
+	columnIndex = nullptr;
 	delete mainRecordArray;
 	mainRecordArray = nullptr;
 	delete mainHashTable;
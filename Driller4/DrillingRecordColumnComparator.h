@@ -0,0 +1,98 @@
+#pragma once
+#ifndef DRILLING_RECORD_COLUMN_COMPARATOR_H
+#define DRILLING_RECORD_COLUMN_COMPARATOR_H
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include "Comparator.h"
+#include "SortKeyExtractor.h"
+#include "KeyComparator.h"
+#include "DrillingRecord.h"
+#include "DrillingRecordKeyComparator.h"
+
+// compares records on a column chosen at compile time, with the same results as DrillingRecordComparator(COLUMN)
+// the class is final, so Sorter, the searches and AVLTree call compare directly and can inline it when they
+// are given this type instead of a Comparator<DrillingRecord>
+// on the string columns it also compares records against bare text, so AVLTree::findKey needs no record
+template <unsigned int COLUMN>
+class DrillingRecordColumnComparator final : public Comparator<DrillingRecord>, public SortKeyExtractor<DrillingRecord>,
+	public KeyComparator<DrillingRecord, std::string_view> {
+	static_assert(COLUMN < MAX_STRINGS + MAX_NUMS, "DrillingRecord has no such column");
+public:
+	// returns -1 if item1 < item2, 0 if item1 == item2, +1 if item1 > item2
+	int compare(const DrillingRecord& item1, const DrillingRecord& item2) const override;
+
+	bool getSortKey(const DrillingRecord& item, unsigned long long& key) const override;
+
+	// throws a new ExceptionIndexOutOfRange when the column is numeric
+	int compareKey(const std::string_view& key, const DrillingRecord& item) const override;
+};
+
+/*
+Method to compare two DrillingRecord objects on the column
+*/
+template <unsigned int COLUMN>
+int DrillingRecordColumnComparator<COLUMN>::compare(const DrillingRecord& item1, const DrillingRecord& item2) const {
+
+	//gets each string once instead of once per comparison
+	if constexpr (COLUMN < MAX_STRINGS) {
+		const std::string string1 = item1.getString(COLUMN);
+		const std::string string2 = item2.getString(COLUMN);
+		int result = string1.compare(string2);
+		return (result < 0) ? -1 : ((result > 0) ? 1 : 0);
+	}
+	else {
+
+		//returns -2 when neither is smaller, larger or equal, just like DrillingRecordComparator does for NaN
+		double num1 = item1.getNum(COLUMN - MAX_STRINGS);
+		double num2 = item2.getNum(COLUMN - MAX_STRINGS);
+		if (num1 < num2) {
+			return -1;
+		}
+		else if (num1 == num2) {
+			return 0;
+		}
+		else if (num1 > num2) {
+			return 1;
+		}
+		return -2;
+	}
+}
+
+/*
+Method to get the radix sort key of the column
+*/
+template <unsigned int COLUMN>
+bool DrillingRecordColumnComparator<COLUMN>::getSortKey(const DrillingRecord& item, unsigned long long& key) const {
+	return DrillingRecordKeyComparator::getColumnKey(item, COLUMN, key);
+}
+
+/*
+Method to compare text with the column of a record
+*/
+template <unsigned int COLUMN>
+int DrillingRecordColumnComparator<COLUMN>::compareKey(const std::string_view& key, const DrillingRecord& item) const {
+	return DrillingRecordKeyComparator::compareColumnText(key, item, COLUMN);
+}
+
+/*
+Method to call function with the DrillingRecordColumnComparator for a column only known at run time,
+each column gets its own copy of function compiled against its own comparator type
+*/
+template <unsigned int COLUMN = 0, typename Function>
+void withColumnComparator(unsigned int column, Function&& function) {
+	if constexpr (COLUMN < MAX_STRINGS + MAX_NUMS) {
+		if (column == COLUMN) {
+			function(DrillingRecordColumnComparator<COLUMN>());
+		}
+		else {
+			withColumnComparator<COLUMN + 1>(column, std::forward<Function>(function));
+		}
+	}
+	else {
+		throw new ExceptionIndexOutOfRange();
+	}
+}
+
+#endif // !DRILLING_RECORD_COLUMN_COMPARATOR_H
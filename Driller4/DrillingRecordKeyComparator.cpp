@@ -0,0 +1,83 @@
+#include "DrillingRecordKeyComparator.h"
+#include <cstring>
+#include <string>
+
+using namespace std;
+
+/*
+Constructor for a comparator on the given column
+*/
+DrillingRecordKeyComparator::DrillingRecordKeyComparator(unsigned int column) : DrillingRecordComparator(column) {
+	this->column = column;
+}
+
+/*
+Method to turn the compared column of a record into an unsigned key with the same order
+*/
+bool DrillingRecordKeyComparator::getSortKey(const DrillingRecord& item, unsigned long long& key) const {
+	return getColumnKey(item, column, key);
+}
+
+/*
+Method to compare text with the compared column of a record
+*/
+int DrillingRecordKeyComparator::compareKey(const string_view& key, const DrillingRecord& item) const {
+	return compareColumnText(key, item, column);
+}
+
+/*
+Method to compare text with a string column of a record, in the order DrillingRecordComparator uses
+*/
+int DrillingRecordKeyComparator::compareColumnText(const string_view& key, const DrillingRecord& item, unsigned int column) {
+	if (column >= MAX_STRINGS) {
+		throw new ExceptionIndexOutOfRange();
+	}
+
+	//time stamps and dates are short enough that the copy getString returns stays off the heap
+	const string text = item.getString(column);
+	int result = key.compare(text);
+	return (result < 0) ? -1 : ((result > 0) ? 1 : 0);
+}
+
+/*
+Method to turn a column of a record into an unsigned key that orders records the way DrillingRecordComparator does
+*/
+bool DrillingRecordKeyComparator::getColumnKey(const DrillingRecord& item, unsigned int column, unsigned long long& key) {
+
+	//strings compare byte by byte as unsigned chars, so packing the bytes first to last with zeros
+	//after the end keeps the order as long as the text fits and has no zero bytes of its own
+	if (column < 2) {
+		string text = item.getString(column);
+		if (text.size() > sizeof(key) || text.find('\0') != string::npos) {
+			return false;
+		}
+
+		key = 0;
+		for (unsigned int i = 0; i < sizeof(key); i++) {
+			key <<= 8;
+			if (i < text.size()) {
+				key |= (unsigned char)text[i];
+			}
+		}
+		return true;
+	}
+
+	//NaN doesn't compare equal to anything, so there is no key that orders it like compare does
+	double value = item.getNum(column - 2);
+	if (value != value) {
+		return false;
+	}
+
+	//-0.0 compares equal to 0.0 so they must share a key
+	if (value == 0.0) {
+		value = 0.0;
+	}
+
+	//flips the sign bit of positive numbers and every bit of negative ones, which makes the
+	//bit patterns count up in the same order as the doubles
+	unsigned long long bits = 0;
+	memcpy(&bits, &value, sizeof(bits));
+	const unsigned long long SIGN_BIT = 1ULL << 63;
+	key = (bits & SIGN_BIT) ? ~bits : (bits | SIGN_BIT);
+	return true;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#ifndef DRILLING_RECORD_KEY_COMPARATOR_H
+#define DRILLING_RECORD_KEY_COMPARATOR_H
+
+#include "DrillingRecordComparator.h"
+#include <string_view>
+#include "SortKeyExtractor.h"
+#include "KeyComparator.h"
+#include "DrillingRecord.h"
+
+// compares records exactly like DrillingRecordComparator and also gives Sorter a radix key for the column,
+// numeric columns always have one and string columns have one while the text fits in 8 bytes
+// on the string columns it also compares records against bare text, so containers can find a record by it
+class DrillingRecordKeyComparator : public DrillingRecordComparator, public SortKeyExtractor<DrillingRecord>,
+	public KeyComparator<DrillingRecord, std::string_view> {
+private:
+	unsigned int column = 0;                           // column the records are compared on
+public:
+	DrillingRecordKeyComparator(unsigned int column);
+
+	bool getSortKey(const DrillingRecord& item, unsigned long long& key) const;
+
+	// throws a new ExceptionIndexOutOfRange when the column is numeric
+	int compareKey(const std::string_view& key, const DrillingRecord& item) const;
+
+	// the key of the given column of a record, shared with DrillingRecordColumnComparator
+	static bool getColumnKey(const DrillingRecord& item, unsigned int column, unsigned long long& key);
+
+	// compares text with a string column of a record, shared with DrillingRecordColumnComparator
+	static int compareColumnText(const std::string_view& key, const DrillingRecord& item, unsigned int column);
+};
+
+#endif // !DRILLING_RECORD_KEY_COMPARATOR_H
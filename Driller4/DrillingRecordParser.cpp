@@ -0,0 +1,49 @@
+#include "DrillingRecordParser.h"
+#include <charconv>
+#include <cctype>
+#include <system_error>
+
+using namespace std;
+
+/*
+Method to split the next comma separated field off the front of a line without copying it
+*/
+string_view DrillingRecordParser::nextField(string_view& line) {
+
+	//finds the end of the field and moves the line past it
+	size_t comma = line.find(',');
+	string_view field = line.substr(0, comma);
+	if (comma == string_view::npos) {
+		line = string_view();
+	}
+	else {
+		line.remove_prefix(comma + 1);
+	}
+	return field;
+}
+
+/*
+Method to turn a field into a double without building a string, throwing, or consulting the locale
+*/
+bool DrillingRecordParser::parseDouble(string_view field, double& value) {
+
+	const char* first = field.data();
+	const char* last = first + field.size();
+
+	//skips leading and trailing whitespace (including the \r of a windows line ending) like stod does
+	while (first < last && isspace((unsigned char)*first)) {
+		first++;
+	}
+	while (last > first && isspace((unsigned char)last[-1])) {
+		last--;
+	}
+
+	//from_chars doesn't accept a leading plus sign so it is skipped here
+	if (first < last && *first == '+') {
+		first++;
+	}
+
+	//the whole field has to be a number
+	from_chars_result parsed = from_chars(first, last, value);
+	return parsed.ec == errc() && parsed.ptr == last;
+}
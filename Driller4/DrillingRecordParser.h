@@ -0,0 +1,82 @@
+#pragma once
+#ifndef DRILLING_RECORD_PARSER_H
+#define DRILLING_RECORD_PARSER_H
+
+#include <string>
+#include <string_view>
+#include "DrillingRecord.h"
+
+// reasons a data line can be rejected, in the order they are checked
+enum class RowRejection : int { none, badDate, duplicateTime, nonPositiveFloat, malformedFloat };
+
+// outcome of parsing one data line, the views point into the line that was parsed
+struct RowParseResult {
+	RowRejection rejection = RowRejection::none;               // why the line was rejected, none if it is valid
+	std::string_view date;                                     // the date field of the line
+	std::string_view time;                                     // the time field of the line
+	unsigned int column = 0;                                   // column (2-17) of the first bad value
+};
+
+class DrillingRecordParser {
+private:
+	static std::string_view nextField(std::string_view& line);  // splits the next field off the front of line
+public:
+	// parses field as a decimal number into value and returns true, returns false if field is not a number
+	// never throws and doesn't depend on the locale
+	static bool parseDouble(std::string_view field, double& value);
+
+	// tokenizes line once, checking the date against dateStamp, the time with isDuplicate(time) and that
+	// every numeric value is a positive number, stopping at the first check that fails
+	// on success the record is fully populated and rejection is none, otherwise the record is left incomplete
+	template <typename DuplicateCheck>
+	static RowParseResult parse(std::string_view line, const std::string& dateStamp, DrillingRecord& record, const DuplicateCheck& isDuplicate);
+};
+
+// Implementation of the template member is below since it must be visible to callers.
+
+/*
+Method to validate and parse a data line in a single pass
+*/
+template <typename DuplicateCheck>
+RowParseResult DrillingRecordParser::parse(std::string_view line, const std::string& dateStamp, DrillingRecord& record, const DuplicateCheck& isDuplicate) {
+
+	RowParseResult result;
+	std::string_view fields = line;
+
+	//checks the date stamp first since nothing else matters if it doesn't match
+	result.date = nextField(fields);
+	if (result.date != dateStamp) {
+		result.rejection = RowRejection::badDate;
+		return result;
+	}
+
+	//checks the time stamp against the ones already read
+	result.time = nextField(fields);
+	if (isDuplicate(result.time)) {
+		result.rejection = RowRejection::duplicateTime;
+		return result;
+	}
+
+	//parses each numeric value straight into the record, stopping at the first one that isn't a positive number
+	for (unsigned int i = 0; i < MAX_NUMS; i++) {
+		double value = 0.0;
+		if (!parseDouble(nextField(fields), value)) {
+			result.rejection = RowRejection::malformedFloat;
+			result.column = i + 2;
+			return result;
+		}
+		if (value <= 0) {
+			result.rejection = RowRejection::nonPositiveFloat;
+			result.column = i + 2;
+			return result;
+		}
+		record.addNum(value);
+	}
+
+	//strings are only built once the line is known to be valid
+	record.addString(std::string(result.date));
+	record.addString(std::string(result.time));
+	return result;
+}
+
+#endif // !DRILLING_RECORD_PARSER_H
@@ -0,0 +1,121 @@
+#include "EpochReclaimer.h"
+
+#include <thread>
+
+using namespace std;
+
+/*
+Constructor, every slot starts free
+*/
+EpochReclaimer::EpochReclaimer() {
+}
+
+/*
+Destructor, deletes everything still retired
+*/
+EpochReclaimer::~EpochReclaimer() {
+	for (const Retired& object : retired) {
+		object.destroy(object.pointer);
+	}
+	retired.clear();
+}
+
+/*
+Method to start a read section
+The slot is claimed with the epoch already in it and a full fence follows, so either a writer scanning the
+slots sees this reader or every unlink before that scan is visible to the reads that follow
+*/
+unsigned int EpochReclaimer::enter() {
+
+	//each thread starts at its own slot so readers rarely share a cache line
+	static atomic<unsigned int> nextThread{ 0 };
+	thread_local unsigned int preferred = nextThread.fetch_add(1, memory_order_relaxed) % READER_SLOTS;
+
+	unsigned long long current = epoch.load(memory_order_seq_cst);
+	for (unsigned int i = 0;; i++) {
+		unsigned int slot = (preferred + i) % READER_SLOTS;
+		unsigned long long expected = 0;
+		if (slots[slot].epoch.load(memory_order_relaxed) == 0 &&
+			slots[slot].epoch.compare_exchange_strong(expected, current, memory_order_seq_cst)) {
+			atomic_thread_fence(memory_order_seq_cst);
+			return slot;
+		}
+
+		//every slot is taken, lets another reader finish
+		if (i % READER_SLOTS == READER_SLOTS - 1) {
+			this_thread::yield();
+		}
+	}
+}
+
+/*
+Method to end a read section
+*/
+void EpochReclaimer::exit(unsigned int slot) {
+	slots[slot].epoch.store(0, memory_order_release);
+}
+
+/*
+Method to hand over an unlinked object, tagged with the epoch after its unlink
+*/
+void EpochReclaimer::retire(void* pointer, void (*destroy)(void*)) {
+	lock_guard<mutex> guard(retireLock);
+	retired.push_back({ pointer, destroy, epoch.load(memory_order_seq_cst) });
+	if (retired.size() >= RECLAIM_THRESHOLD) {
+		reclaimLocked();
+	}
+}
+
+/*
+Method to free every retired object no reader can see
+*/
+void EpochReclaimer::reclaim() {
+	lock_guard<mutex> guard(retireLock);
+	reclaimLocked();
+}
+
+/*
+Method to free the retired objects that are older than every reader inside a read section
+*/
+void EpochReclaimer::reclaimLocked() {
+
+	//readers entering from now on get the new epoch, so they are newer than anything retired so far
+	unsigned long long current = epoch.fetch_add(1, memory_order_seq_cst) + 1;
+	atomic_thread_fence(memory_order_seq_cst);
+
+	//finds the epoch of the oldest reader still inside
+	unsigned long long oldest = current;
+	for (unsigned int i = 0; i < READER_SLOTS; i++) {
+		unsigned long long entered = slots[i].epoch.load(memory_order_seq_cst);
+		if (entered != 0 && entered < oldest) {
+			oldest = entered;
+		}
+	}
+
+	//deletes what was retired before that reader entered and keeps the rest in order
+	unsigned long kept = 0;
+	for (unsigned long i = 0; i < retired.size(); i++) {
+		if (retired[i].epoch < oldest) {
+			retired[i].destroy(retired[i].pointer);
+		}
+		else {
+			retired[kept] = retired[i];
+			kept++;
+		}
+	}
+	retired.resize(kept);
+}
+
+/*
+Constructor, enters a read section
+*/
+EpochGuard::EpochGuard(EpochReclaimer& reclaimer) : reclaimer(reclaimer) {
+	slot = reclaimer.enter();
+}
+
+/*
+Destructor, leaves the read section
+*/
+EpochGuard::~EpochGuard() {
+	reclaimer.exit(slot);
+}
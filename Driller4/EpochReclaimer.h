@@ -0,0 +1,65 @@
+#pragma once
+#ifndef EPOCH_RECLAIMER_H
+#define EPOCH_RECLAIMER_H
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+const unsigned int READER_SLOTS = 64;                         // readers that can be inside a read section at once
+const unsigned long RECLAIM_THRESHOLD = 256;                  // retired objects that set off an attempt to free them
+
+// EpochReclaimer frees objects that lock-free readers may still be looking at, once no reader can be
+// a reader enters a read section by publishing the current epoch in a slot and leaves by clearing it
+// a writer retires an object after unlinking it, tagged with the epoch at that point, and the object is
+// deleted once every reader still inside a read section entered at a later epoch, since those readers
+// started after the unlink and can't reach it
+class EpochReclaimer {
+private:
+	struct alignas(64) ReaderSlot {
+		std::atomic<unsigned long long> epoch{ 0 };           // epoch the reader entered at, 0 if the slot is free
+	};
+	struct Retired {
+		void* pointer;                                        // the object waiting to be deleted
+		void (*destroy)(void*);                               // deletes pointer as its own type
+		unsigned long long epoch;                             // epoch when it was retired
+	};
+	ReaderSlot slots[READER_SLOTS];
+	std::atomic<unsigned long long> epoch{ 1 };               // advanced by every attempt to free retired objects
+	std::mutex retireLock;                                    // guards retired
+	std::vector<Retired> retired;                             // objects unlinked but maybe still being read
+	void reclaimLocked();                                     // frees what no reader can see, retireLock must be held
+public:
+	EpochReclaimer();
+	EpochReclaimer(const EpochReclaimer&) = delete;
+	EpochReclaimer& operator=(const EpochReclaimer&) = delete;
+	virtual ~EpochReclaimer();                                // deletes everything still retired, no reader may be inside
+
+	unsigned int enter();                                     // starts a read section, returns the slot to pass to exit
+	void exit(unsigned int slot);                             // ends the read section started in slot
+
+	// hands over an object already unlinked from every shared pointer, it is deleted once no reader can see it
+	void retire(void* pointer, void (*destroy)(void*));
+
+	// retire for any type deleted with delete
+	template <typename U>
+	void retire(U* pointer) {
+		retire(pointer, [](void* object) { delete static_cast<U*>(object); });
+	}
+
+	void reclaim();                                           // frees every retired object no reader can see
+};
+
+// keeps a read section open for as long as it is in scope
+class EpochGuard {
+private:
+	EpochReclaimer& reclaimer;
+	unsigned int slot;
+public:
+	EpochGuard(EpochReclaimer& reclaimer);
+	EpochGuard(const EpochGuard&) = delete;
+	EpochGuard& operator=(const EpochGuard&) = delete;
+	~EpochGuard();
+};
+
+#endif // !EPOCH_RECLAIMER_H
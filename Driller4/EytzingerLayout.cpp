@@ -0,0 +1,102 @@
+#include "EytzingerLayout.h"
+
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+using namespace std;
+
+/*
+Function to ask for the cache line at an address without waiting for it, the address may be past
+the end of the keys since a prefetch never faults
+*/
+static inline void prefetch(uintptr_t address) {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE__)
+	_mm_prefetch((const char*)address, _MM_HINT_T0);
+#elif defined(__GNUC__)
+	__builtin_prefetch((const void*)address);
+#else
+	(void)address;
+#endif
+}
+
+/*
+Default constructor
+*/
+EytzingerLayout::EytzingerLayout() {
+}
+
+/*
+Method to fill the subtree at node with sorted keys starting at next, returns the next unused key
+An in order walk of the tree visits the nodes in key order, so each node takes the next sorted key
+*/
+unsigned long EytzingerLayout::place(const vector<unsigned long long>& sortedKeys, unsigned long next, unsigned long node) {
+	if (node <= size) {
+		next = place(sortedKeys, next, 2 * node);
+		keys[node] = sortedKeys[next];
+		ranks[node] = next;
+		next = place(sortedKeys, next + 1, 2 * node + 1);
+	}
+	return next;
+}
+
+/*
+Method to lay out a new set of sorted keys
+*/
+void EytzingerLayout::build(const vector<unsigned long long>& sortedKeys) {
+	size = (unsigned long)sortedKeys.size();
+
+	//keys[0] goes at the start of a cache line so the 8 descendants 3 levels below any node, which are
+	//at 8 * node to 8 * node + 7, share one line
+	storage.assign(size + 1 + EYTZINGER_LINE_KEYS, 0);
+	uintptr_t start = (uintptr_t)storage.data();
+	uintptr_t lineBytes = EYTZINGER_LINE_KEYS * sizeof(unsigned long long);
+	keys = (unsigned long long*)((start + lineBytes - 1) / lineBytes * lineBytes);
+
+	ranks.assign(size + 1, 0);
+	place(sortedKeys, 0, 1);
+}
+
+/*
+Method to find the rank of the first key not less than the given key
+*/
+unsigned long EytzingerLayout::lowerBound(unsigned long long key) const {
+	unsigned long node = 1;
+
+	//goes left on keys not less than key and right otherwise, the comparison becomes the next bit of node
+	//and the line holding the descendants 3 levels down is fetched on the way
+	while (node <= size) {
+		prefetch((uintptr_t)keys + (uintptr_t)node * EYTZINGER_LINE_KEYS * sizeof(unsigned long long));
+		node = 2 * node + (keys[node] < key);
+	}
+
+	//the trailing 1 bits are the right turns after the last left turn, which was at the answer
+	while (node & 1) {
+		node >>= 1;
+	}
+	node >>= 1;
+
+	//no left turn means every key is less than key
+	return (node == 0) ? size : ranks[node];
+}
+
+/*
+Method to find the rank of the first key greater than the given key
+*/
+unsigned long EytzingerLayout::upperBound(unsigned long long key) const {
+
+	//keys are whole numbers, so the first key greater than key is the first not less than key + 1
+	if (key == ~0ULL) {
+		return size;
+	}
+	return lowerBound(key + 1);
+}
+
+/*
+Method to get the number of keys
+*/
+unsigned long EytzingerLayout::getSize() const {
+	return size;
+}
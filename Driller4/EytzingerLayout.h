@@ -0,0 +1,35 @@
+#pragma once
+#ifndef EYTZINGER_LAYOUT_H
+#define EYTZINGER_LAYOUT_H
+
+#include <vector>
+
+const unsigned long EYTZINGER_LINE_KEYS = 8;                  // keys in one 64 byte cache line
+
+// EytzingerLayout stores sorted keys in the breadth first order of a complete binary search tree,
+// the children of the key at k are at 2k and 2k + 1, so the first levels of every search share the
+// same few cache lines, and the line holding the nodes 3 levels down is fetched while the current
+// level is compared
+// the descent has no data dependent branch, every search takes the same number of steps
+// it is built once from keys that then stay the same, and answers bounds as ranks in the sorted keys
+class EytzingerLayout {
+private:
+	std::vector<unsigned long long> storage;                   // memory for keys, with room to align keys[0] to a cache line
+	unsigned long long* keys = nullptr;                        // keys in tree order from keys[1], keys[0] is unused
+	std::vector<unsigned long> ranks;                          // position in the sorted keys of each key in tree order
+	unsigned long size = 0;                                    // number of keys
+	unsigned long place(const std::vector<unsigned long long>& sortedKeys, unsigned long next, unsigned long node);  // fills the subtree at node in order
+public:
+	EytzingerLayout();                                         // creates a layout with no keys
+	EytzingerLayout(const EytzingerLayout&) = delete;          // keys points into storage
+	EytzingerLayout& operator=(const EytzingerLayout&) = delete;
+
+	// replaces the keys with sortedKeys, which must be in ascending order
+	void build(const std::vector<unsigned long long>& sortedKeys);
+
+	unsigned long lowerBound(unsigned long long key) const;    // returns the rank of the first key not less than key, size if there is none
+	unsigned long upperBound(unsigned long long key) const;    // returns the rank of the first key greater than key, size if there is none
+	unsigned long getSize() const;                             // returns the number of keys
+};
+
+#endif // !EYTZINGER_LAYOUT_H
@@ -8,11 +8,14 @@ so while aspects and the structure of parts of my code may resemble theirs, all
 */
 
 #include <math.h>
+#include <vector>
 #include "Exceptions.h"
 #include "Comparator.h"
 #include "OULinkedList.h"
 #include "OULinkedListEnumerator.h"
 #include "Hasher.h"
+#include "KeyHasher.h"
+#include "KeyComparator.h"
 
 const unsigned int SCHEDULE_SIZE = 25;
 const unsigned int SCHEDULE[SCHEDULE_SIZE] = { 1, 2, 5, 11, 23, 53, 107, 223, 449, 907, 1823, 3659, 7309, 14621, 29243, 58511, 117023, 234067, 468157, 936319, 1872667, 3745283, 7490573, 14981147, 29962343 };
@@ -21,6 +24,22 @@ const unsigned long DEFAULT_BASE_CAPACITY = SCHEDULE[DEFAULT_SCHEDULE_INDEX];
 const float DEFAULT_MAX_LOAD_FACTOR = 0.8f;
 const float DEFAULT_MIN_LOAD_FACTOR = 0.3f;
 
+// least rehash work done by each insert, replace and remove while the table is being resized, each one
+// makes empty chains of the new table until they all exist and then moves buckets of the old table into it
+// startRehash raises both shares so the whole rehash fits in the inserts or removes that could set off the
+// next resize, a quarter of them for the chains, which are cheap, and the rest for the buckets
+const unsigned long REHASH_CHAINS = 16;
+const unsigned long REHASH_BUCKETS = 2;
+
+// how evenly the items of a hash table are spread over its buckets, see getStatistics
+// with a good hash function the longest chain stays a small number and the variance stays close to the mean
+struct HashTableStatistics {
+	unsigned long usedBuckets = 0;                             // buckets holding at least one item
+	unsigned long longestChain = 0;                            // most items in any one bucket
+	double meanChain = 0.0;                                    // items per bucket, the load on the base capacity
+	double chainVariance = 0.0;                                // variance of the number of items in each bucket
+};
+
 template <typename T>
 class HashTable {
 	template <typename U>
@@ -36,8 +55,21 @@ private:
 	unsigned long totalCapacity = baseCapacity;                // the size of the array plus chains of more than one link
 	OULinkedList<T>** table = NULL;                            // table will be an array of pointers to OULinkedLists of type T
 	// you may add additional member variables and functions here to support the operation of your code
+	OULinkedList<T>** oldTable = nullptr;                      // the table being rehashed out of, nullptr if no rehash is in progress
+	unsigned long oldBaseCapacity = 0;                         // the size of the old table
+	unsigned long migratedBuckets = 0;                         // old buckets below this one have been moved into table
+	unsigned long createdBuckets = 0;                          // buckets of table below this one have a chain
+	unsigned long chainsPerStep = REHASH_CHAINS;               // chains of table each rehashStep makes
+	unsigned long bucketsPerStep = REHASH_BUCKETS;             // old buckets each rehashStep moves once every chain exists
 	void increaseHashTableSize();
 	void decreaseHashTableSize();
+	void startRehash(unsigned int newScheduleIndex);           // makes table the old table and starts one of the new size
+	void rehashStep();                                         // does one operation's share of any rehash in progress
+	void migrateBucket();                                      // moves the next old bucket into table
+	void finishRehash();                                       // does all of any rehash in progress
+	OULinkedList<T>* getChain(unsigned long hash) const;       // the chain that holds or would hold an item with this hash
+	template <typename K>
+	const T* findKeyItem(const K& key) const;                  // item with key, nullptr if there is none
 public:
 	HashTable(Comparator<T>* comparator, Hasher<T>* hasher);            // creates an empty table of DEFAULT_BASE_CAPACITY
 	HashTable(Comparator<T>* comparator, Hasher<T>* hasher,
@@ -63,11 +95,24 @@ public:
 	// if an equivalent item is not present, throw a new ExceptionHashTableAccess
 	T find(T item) const;
 
+	// lookups by a key of type K instead of a whole item, the hasher has to be a KeyHasher<K> and the
+	// comparator a KeyComparator<T, K>, otherwise they throw a new ExceptionHashTableAccess
+	// if an item with the key is present, return true
+	// if an item with the key is not present, false
+	template <typename K>
+	bool containsKey(const K& key) const;
+
+	// if an item with the key is present, return a copy of the item
+	// if an item with the key is not present, throw a new ExceptionHashTableAccess
+	template <typename K>
+	T findKey(const K& key) const;
+
 	unsigned long getSize() const;                            // returns the current number of items in the table
 	unsigned long getBaseCapacity() const;                    // returns the current base capacity of the table
 	unsigned long getTotalCapacity() const;                    // returns the current total capacity of the table
 	float getLoadFactor() const;                            // returns the current load factor of the table
 	unsigned long getBucketNumber(T item) const;            // returns the current bucket number for an item
+	HashTableStatistics getStatistics() const;              // returns how the items are spread over the buckets
 };
 
 // Add your implementation below this line.
@@ -87,6 +132,7 @@ HashTable<T>::HashTable(Comparator<T>* comparator, Hasher<T>* hasher) {
 	for (unsigned long i = 0; i < baseCapacity; i++) {
 		table[i] = new OULinkedList<T>(comparator);
 	}
+	createdBuckets = baseCapacity;
 }
 
 
@@ -104,15 +150,16 @@ HashTable<T>::HashTable(Comparator<T>* comparator, Hasher<T>* hasher,
 	this->maxLoadFactor = maxLoadFactor;
 	this->minLoadFactor = minLoadFactor;
 
-	int scheduleNum = 0;
+	unsigned int scheduleNum = 0;
 
 	//iterates through and finds the correct size of hash table to make
-	while ((float) size > (float) SCHEDULE[scheduleNum] * maxLoadFactor && scheduleIndex < SCHEDULE_SIZE) {
+	while ((float) size > (float) SCHEDULE[scheduleNum] * maxLoadFactor && scheduleNum + 1 < SCHEDULE_SIZE) {
 		scheduleNum++;
 	}
 
-	//makes a new hash table
+	//makes a new hash table, the schedule index is kept so resizes step from this size
 	this->table = new OULinkedList<T>* [SCHEDULE[scheduleNum]];
+	scheduleIndex = scheduleNum;
 	baseCapacity = SCHEDULE[scheduleNum];
 	totalCapacity = baseCapacity;
 
@@ -120,6 +167,7 @@ HashTable<T>::HashTable(Comparator<T>* comparator, Hasher<T>* hasher,
 	for (unsigned long i = 0; i < baseCapacity; i++) {
 		table[i] = new OULinkedList<T>(comparator);
 	}
+	createdBuckets = baseCapacity;
 }
 
 
@@ -129,6 +177,18 @@ Destructor for the hash table
 template <typename T>
 HashTable<T>::~HashTable() {
 
+	//deletes the chains of both tables, old buckets below migratedBuckets were already deleted
+	for (unsigned long i = 0; i < createdBuckets; i++) {
+		delete table[i];
+	}
+	if (oldTable != nullptr) {
+		for (unsigned long i = migratedBuckets; i < oldBaseCapacity; i++) {
+			delete oldTable[i];
+		}
+		delete[] oldTable;
+		oldTable = nullptr;
+	}
+
 	//table
 	delete[] table;
 	table = nullptr;
@@ -141,14 +201,17 @@ Method to insert an item into the hash table
 template <typename T>
 bool HashTable<T>::insert(T item) {
 
-	//get the bucket number of the item to insert
-	unsigned long itemBucketNumber = getBucketNumber(item);
+	//moves any rehash in progress along
+	rehashStep();
+
+	//get the chain of the item to insert
+	OULinkedList<T>* chain = getChain(hasher->hash(item));
 
 	//branch if the item is inserted successfully
-	if (table[itemBucketNumber]->insert(item)) {
+	if (chain->insert(item)) {
 
 		//if bucket already contains something, increase total capacity
-		if (table[itemBucketNumber]->getSize() > 1) {
+		if (chain->getSize() > 1) {
 			totalCapacity++;
 		}
 		size++;
@@ -169,7 +232,9 @@ Method to replace an item in the hash table
 template <typename T>
 bool HashTable<T>::replace(T item) {
 
-	return table[getBucketNumber(item)]->replace(item);
+	//moves any rehash in progress along
+	rehashStep();
+	return getChain(hasher->hash(item))->replace(item);
 }
 
 
@@ -179,16 +244,20 @@ Method to remove item from the hash table
 template <typename T>
 bool HashTable<T>::remove(T item) {
 
+	//moves any rehash in progress along
+	rehashStep();
+	OULinkedList<T>* chain = getChain(hasher->hash(item));
+
 	//if bucket is empty, return false
-	if (table[getBucketNumber(item)]->getSize() == 0) {
+	if (chain->getSize() == 0) {
 
 		return false;
 	}
 	//if bucket contains item, remove it
-	else if (table[getBucketNumber(item)]->remove(item)) {
+	else if (chain->remove(item)) {
 
 		//checks if bucket isn't empty after removing
-		if (table[getBucketNumber(item)]->getSize() != 0) {
+		if (chain->getSize() != 0) {
 			totalCapacity--;
 		}
 		size--;
@@ -210,12 +279,12 @@ Method to find an item in the hash table
 template <typename T>
 T HashTable<T>::find(T item) const {
 
-	//gets bucket number of item
-	unsigned long itemBucketNumber = getBucketNumber(item);
+	//gets the chain of the item, which is in the old table if its bucket there hasn't been moved yet
+	OULinkedList<T>* chain = getChain(hasher->hash(item));
 
 	//checks if bucket linked list contains item
-	if (table[itemBucketNumber]->contains(item)) {
-		return table[itemBucketNumber]->find(item);
+	if (chain->contains(item)) {
+		return chain->find(item);
 	}
 	//throws exception if not
 	else {
@@ -224,6 +293,50 @@ T HashTable<T>::find(T item) const {
 }
 
 
+/*
+Method to find an item by its key, the hasher and comparator are each checked once and the chain is
+searched once
+*/
+template <typename T>
+template <typename K>
+const T* HashTable<T>::findKeyItem(const K& key) const {
+
+	//checks the hasher and comparator can both work from a key of this type
+	const KeyHasher<K>* keyHasher = dynamic_cast<const KeyHasher<K>*>(hasher);
+	const KeyComparator<T, K>* keyComparator = dynamic_cast<const KeyComparator<T, K>*>(comparator);
+	if (keyHasher == nullptr || keyComparator == nullptr) {
+		throw new ExceptionHashTableAccess;
+	}
+	return getChain(keyHasher->hashKey(key))->findKeyItem(key, *keyComparator);
+}
+
+
+/*
+Method to check if the hash table contains an item with the given key
+*/
+template <typename T>
+template <typename K>
+bool HashTable<T>::containsKey(const K& key) const {
+	return findKeyItem(key) != nullptr;
+}
+
+
+/*
+Method to find an item in the hash table by its key
+*/
+template <typename T>
+template <typename K>
+T HashTable<T>::findKey(const K& key) const {
+	const T* item = findKeyItem(key);
+
+	//throws exception if no item has the key
+	if (item == nullptr) {
+		throw new ExceptionHashTableAccess;
+	}
+	return *item;
+}
+
+
 /*
 Method to return size of the hash table
 */
@@ -260,6 +373,19 @@ float HashTable<T>::getLoadFactor() const {
 }
 
 
+/*
+Method to return the chain an item with the given hash belongs in, during a rehash an item whose old bucket
+hasn't been moved yet is still in the old table
+*/
+template <typename T>
+OULinkedList<T>* HashTable<T>::getChain(unsigned long hash) const {
+	if (oldTable != nullptr && hash % oldBaseCapacity >= migratedBuckets) {
+		return oldTable[hash % oldBaseCapacity];
+	}
+	return table[hash % baseCapacity];
+}
+
+
 /*
 Method to return the bucket number of a given item
 */
@@ -270,117 +396,189 @@ unsigned long HashTable<T>::getBucketNumber(T item) const {
 
 
 /*
-Method to increase the size of the hash table
+Method to measure how evenly the items are spread over the buckets
 */
 template <typename T>
-void HashTable<T>::increaseHashTableSize() {
-
-	//stores old base capacity
-	unsigned long oldBaseCapacity = baseCapacity;
-
-	//increment schedule index and reassign base and total capacity
-	scheduleIndex++;
-	baseCapacity = SCHEDULE[scheduleIndex];
-	totalCapacity = baseCapacity;
-	size = 0;
-
-	//declares a new hash table of new base capacity size
-	OULinkedList<T>** newTable = new OULinkedList<T> * [baseCapacity];
+HashTableStatistics HashTable<T>::getStatistics() const {
+	HashTableStatistics statistics;
+	statistics.meanChain = (double)size / (double)baseCapacity;
+
+	//counts the items of each bucket, items still in the old table count in the bucket they are moving to
+	std::vector<unsigned long> chains(baseCapacity, 0);
+	for (unsigned long i = 0; i < createdBuckets; i++) {
+		chains[i] = table[i]->getSize();
+	}
+	if (oldTable != nullptr) {
+		for (unsigned long i = migratedBuckets; i < oldBaseCapacity; i++) {
+			if (oldTable[i]->getSize() > 0) {
+				OULinkedListEnumerator<T> enumerator = oldTable[i]->enumerator();
+				while (enumerator.hasNext()) {
+					chains[hasher->hash(enumerator.next()) % baseCapacity]++;
+				}
+			}
+		}
+	}
 
-	//puts an OULinkedList in each bucket
+	//sums the squared distance of each chain length from the mean
+	double squares = 0.0;
 	for (unsigned long i = 0; i < baseCapacity; i++) {
-		newTable[i] = new OULinkedList<T>(comparator);
+		unsigned long chain = chains[i];
+		if (chain > 0) {
+			statistics.usedBuckets++;
+		}
+		if (chain > statistics.longestChain) {
+			statistics.longestChain = chain;
+		}
+		squares += ((double)chain - statistics.meanChain) * ((double)chain - statistics.meanChain);
 	}
+	statistics.chainVariance = squares / (double)baseCapacity;
+	return statistics;
+}
 
-	
-	//iterates through the old hash table and rehashes all of the items
-	for (unsigned long i = 0; i < oldBaseCapacity; i++) {
-
-		//checks if table already contains something
-		if (table[i]->getSize() > 0) {
 
-			OULinkedListEnumerator<T> enumerator = table[i]->enumerator();
+/*
+Method to increase the size of the hash table
+*/
+template <typename T>
+void HashTable<T>::increaseHashTableSize() {
+	if (scheduleIndex + 1 < SCHEDULE_SIZE) {
+		startRehash(scheduleIndex + 1);
+	}
+}
 
-			//iterates through each linked list individually
-			while (enumerator.hasNext()) {
 
-				//gets current item and its hash value
-				T currItem = enumerator.next();
-				unsigned long newBucket = getBucketNumber(currItem);
+/*
+Method to decrease the size of the hash table
+*/
+template <typename T>
+void HashTable<T>::decreaseHashTableSize() {
+	if (scheduleIndex > 0) {
+		startRehash(scheduleIndex - 1);
+	}
+}
 
-				//if the bucket already has something, increase total capacity
-				if (newTable[newBucket]->getSize() > 1) {
-					totalCapacity++;
-				}
 
-				//insert the item into the right bucket
-				newTable[newBucket]->insert(currItem);
-				size++;
+/*
+Method to start moving the items into a table of a new size
+Only the array of the new table is made here, its chains and the items are filled in a few at a time by
+rehashStep, so no single operation pays for the whole rehash
+*/
+template <typename T>
+void HashTable<T>::startRehash(unsigned int newScheduleIndex) {
 
-			}
+	//a rehash still in progress is finished first so there are never more than two tables
+	finishRehash();
 
-			//delete the linked list at that index
-			delete table[i];
-		}
+	//the current table becomes the old table
+	oldTable = table;
+	oldBaseCapacity = baseCapacity;
+	migratedBuckets = 0;
 
+	//the overflow of the old chains stays in the total capacity until each chain is moved
+	scheduleIndex = newScheduleIndex;
+	baseCapacity = SCHEDULE[scheduleIndex];
+	totalCapacity = baseCapacity + (totalCapacity - oldBaseCapacity);
+	table = new OULinkedList<T>* [baseCapacity];
+	createdBuckets = 0;
+
+	//counts the inserts that take the load to the max or the removes that take it to the min, whichever is
+	//fewer, each of them does a step before it can start another resize
+	double toGrow = ceil((double)baseCapacity * maxLoadFactor) - (double)size;
+	double toShrink = (double)size - floor((double)baseCapacity * minLoadFactor);
+	double steps = (toGrow < toShrink) ? toGrow : toShrink;
+	if (steps < 1.0) {
+		steps = 1.0;
 	}
 
-	//delete old table and reassign pointer
-	delete[] table;
-	table = newTable;
+	//the chains get a quarter of the steps and the buckets the rest, the step that makes the last chains
+	//also moves buckets, so both fit in steps
+	chainsPerStep = (unsigned long)ceil((double)baseCapacity * 4.0 / steps);
+	if (chainsPerStep < REHASH_CHAINS) {
+		chainsPerStep = REHASH_CHAINS;
+	}
+	bucketsPerStep = (unsigned long)ceil((double)oldBaseCapacity * 4.0 / (steps * 3.0));
+	if (bucketsPerStep < REHASH_BUCKETS) {
+		bucketsPerStep = REHASH_BUCKETS;
+	}
 }
 
+
 /*
-Method to decrease the size of the hash table
+Method to do part of a rehash in progress
+Every chain of the new table is made before any bucket is moved, so until then getChain sends every item
+to the old table
 */
 template <typename T>
-void HashTable<T>::decreaseHashTableSize() {
-
-	//stores old base capacity
-	unsigned long oldBaseCapacity = baseCapacity;
-
-	//increment schedule index and reassign base and total capacity
-	scheduleIndex--;
-	baseCapacity = SCHEDULE[scheduleIndex];
-	totalCapacity = baseCapacity;
+void HashTable<T>::rehashStep() {
+	if (oldTable == nullptr) {
+		return;
+	}
 
-	//declares a new hash table of new base capacity size
-	OULinkedList<T>** newTable = new OULinkedList<T> * [baseCapacity];
+	//puts an OULinkedList in the next buckets of the new table
+	if (createdBuckets < baseCapacity) {
+		unsigned long lastBucket = createdBuckets + chainsPerStep;
+		if (lastBucket > baseCapacity) {
+			lastBucket = baseCapacity;
+		}
+		for (; createdBuckets < lastBucket; createdBuckets++) {
+			table[createdBuckets] = new OULinkedList<T>(comparator);
+		}
+		if (createdBuckets < baseCapacity) {
+			return;
+		}
+	}
 
-	//puts an OULinkedList in each bucket
-	for (unsigned long i = 0; i < baseCapacity; i++) {
-		newTable[i] = new OULinkedList<T>(comparator);
+	//moves the next old buckets into the new table
+	for (unsigned long i = 0; i < bucketsPerStep && oldTable != nullptr; i++) {
+		migrateBucket();
 	}
+}
 
-	//iterates through the old hash table and rehashes all of the items
-	for (unsigned long i = 0; i < oldBaseCapacity; i++) {
-		OULinkedListEnumerator<T> enumerator = table[i]->enumerator();
 
-		//iterates through each linked list individually
-		while (enumerator.hasNext()) {
+/*
+Method to move the items of the next old bucket into the new table
+*/
+template <typename T>
+void HashTable<T>::migrateBucket() {
+	OULinkedList<T>* oldChain = oldTable[migratedBuckets];
+	if (oldChain->getSize() > 0) {
 
-			//gets current item and its hash value
+		//the old chain's overflow leaves the total capacity with it
+		totalCapacity -= oldChain->getSize() - 1;
+		OULinkedListEnumerator<T> enumerator = oldChain->enumerator();
+		while (enumerator.hasNext()) {
 			T currItem = enumerator.next();
-			unsigned long newBucket = getBucketNumber(currItem);
+			OULinkedList<T>* newChain = table[hasher->hash(currItem) % baseCapacity];
+			newChain->insert(currItem);
 
 			//if the bucket already has something, increase total capacity
-			if (newTable[newBucket]->getSize() > 0) {
+			if (newChain->getSize() > 1) {
 				totalCapacity++;
 			}
-
-			//insert the item into the right bucket
-			newTable[newBucket]->insert(currItem);
-
 		}
-
-		//delete the linked list at that index
-		delete table[i];
 	}
+	delete oldChain;
+	migratedBuckets++;
+
+	//deletes the old table once every bucket has been moved
+	if (migratedBuckets == oldBaseCapacity) {
+		delete[] oldTable;
+		oldTable = nullptr;
+		oldBaseCapacity = 0;
+		migratedBuckets = 0;
+	}
+}
 
-	//delete old table and reassign pointer
-	delete[] table;
-	table = newTable;
+
+/*
+Method to do all of a rehash in progress
+*/
+template <typename T>
+void HashTable<T>::finishRehash() {
+	while (oldTable != nullptr) {
+		rehashStep();
+	}
 }
 
 
-#endif // !HASH_TABLE
\ No newline at end of file
+#endif // !HASH_TABLE
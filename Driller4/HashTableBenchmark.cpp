@@ -0,0 +1,173 @@
+// HashTableBenchmark.cpp : compares the chained HashTable with the open addressing OpenHashTable, this file
+// has its own 'main' so it is not part of the Driller4 project
+//
+// build it from this folder with the tables' sources, e.g.
+//     g++ -std=c++17 -O2 HashTableBenchmark.cpp ResizePolicy.cpp TimeStampHasher.cpp DrillingRecord.cpp
+//         DrillingRecordComparator.cpp DrillingRecordKeyComparator.cpp
+//
+// usage: HashTableBenchmark [records]    records defaults to 86400, a full day of time stamps
+// for each time stamp hash function and each table it prints the time per insert and per find and the heap
+// bytes each entry takes, the record's own copy included
+// the asciiSum rows are slow to run with a full day of records, since its few dozen chains are thousands long
+
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+#include <cstdio>
+#include <new>
+#include <vector>
+#include <chrono>
+#include <random>
+#include "Exceptions.h"
+#include "DrillingRecord.h"
+#include "DrillingRecordKeyComparator.h"
+#include "TimeStampHasher.h"
+#include "HashTable.h"
+#include "HashTableEnumerator.h"
+#include "OpenHashTable.h"
+
+using namespace std;
+
+//records in a full day of time stamps, the default number of records
+const unsigned long DAY_SECONDS = 86400;
+
+//finds are repeated in batches of FIND_BATCH until at least FIND_SECONDS have passed
+const unsigned long FIND_BATCH = 1000;
+const double FIND_SECONDS = 0.3;
+
+//bytes currently allocated through new, kept by the replacements of the global operator new and delete below
+unsigned long long liveBytes = 0;
+
+//the replacements aren't inlined, so the compiler doesn't mistake the size kept in front of a block for an
+//access outside it
+#if defined(_MSC_VER)
+#define NO_INLINE __declspec(noinline)
+#elif defined(__GNUC__)
+#define NO_INLINE __attribute__((noinline))
+#else
+#define NO_INLINE
+#endif
+
+//a record for each second of the day, its time stamp is its key
+vector<DrillingRecord> records;
+
+
+/*============================================================================================
+Replacements of the global operator new and delete and their array forms that count the bytes in use,
+each block keeps its size in front of the memory handed out
+*/
+NO_INLINE void* operator new(size_t size) {
+	void* block = malloc(size + alignof(max_align_t));
+	if (block == nullptr) {
+		throw bad_alloc();
+	}
+	*(size_t*)block = size;
+	liveBytes += size;
+	return (char*)block + alignof(max_align_t);
+}
+
+NO_INLINE void operator delete(void* pointer) noexcept {
+	if (pointer != nullptr) {
+		void* block = (char*)pointer - alignof(max_align_t);
+		liveBytes -= *(size_t*)block;
+		free(block);
+	}
+}
+
+NO_INLINE void operator delete(void* pointer, size_t) noexcept {
+	operator delete(pointer);
+}
+
+NO_INLINE void* operator new[](size_t size) {
+	return operator new(size);
+}
+
+NO_INLINE void operator delete[](void* pointer) noexcept {
+	operator delete(pointer);
+}
+
+NO_INLINE void operator delete[](void* pointer, size_t) noexcept {
+	operator delete(pointer);
+}
+//============================================================================================
+
+
+/*============================================================================================
+Function to create a record for the first count seconds of the day
+*/
+void createRecords(unsigned long count) {
+	records.resize(count);
+	for (unsigned long i = 0; i < count; i++) {
+		char timeStamp[16];
+		snprintf(timeStamp, sizeof(timeStamp), "%02lu:%02lu:%02lu", (i / 3600) % 24, (i / 60) % 60, i % 60);
+		records[i].setString("7/31/2017", 0);
+		records[i].setString(timeStamp, 1);
+		records[i].setNum((double)i, 0);
+	}
+}
+//============================================================================================
+
+
+/*============================================================================================
+Function to build a table of every record with one hash function and print its insert and find times
+and bytes per entry, the table is sized for the records as mainHashTable is
+*/
+template <typename Table>
+void measureTable(const string& tableName, const string& hasherName, TimeHashFunction function) {
+	DrillingRecordKeyComparator comparator(1);
+	TimeStampHasher hasher(function);
+	unsigned long long bytesBefore = liveBytes;
+
+	//inserts every record
+	auto began = chrono::steady_clock::now();
+	Table* table = new Table(&comparator, &hasher, (unsigned long)records.size());
+	for (unsigned long i = 0; i < records.size(); i++) {
+		table->insert(records[i]);
+	}
+	double insertSeconds = chrono::duration<double>(chrono::steady_clock::now() - began).count();
+	double bytesPerEntry = (double)(liveBytes - bytesBefore) / (double)records.size();
+
+	//finds random records in batches until enough time has passed to measure
+	mt19937 random(1);
+	unsigned long finds = 0;
+	double checksum = 0;
+	began = chrono::steady_clock::now();
+	double findSeconds = 0;
+	while (findSeconds < FIND_SECONDS) {
+		for (unsigned long i = 0; i < FIND_BATCH; i++) {
+			checksum += table->find(records[random() % records.size()]).getNum(0);
+		}
+		finds += FIND_BATCH;
+		findSeconds = chrono::duration<double>(chrono::steady_clock::now() - began).count();
+	}
+	delete table;
+
+	//the checksum keeps the finds from being optimized away
+	cout << left << setw(10) << hasherName << setw(9) << tableName << right << fixed << setprecision(0)
+		<< setw(12) << insertSeconds * 1e9 / (double)records.size()
+		<< setw(12) << findSeconds * 1e9 / (double)finds
+		<< setw(14) << bytesPerEntry << (checksum < 0 ? " " : "") << endl;
+}
+//============================================================================================
+
+
+int main(int argc, char* argv[]) {
+	unsigned long count = (argc > 1) ? strtoul(argv[1], nullptr, 10) : DAY_SECONDS;
+	if (count == 0) {
+		cout << "usage: HashTableBenchmark [records]" << endl;
+		return 1;
+	}
+	createRecords(count);
+
+	cout << count << " records" << endl;
+	cout << "hasher    table      insert ns     find ns   bytes/entry" << endl;
+	measureTable<HashTable<DrillingRecord>>("chained", "seconds", TimeHashFunction::seconds);
+	measureTable<OpenHashTable<DrillingRecord>>("open", "seconds", TimeHashFunction::seconds);
+	measureTable<HashTable<DrillingRecord>>("chained", "bytes", TimeHashFunction::bytes);
+	measureTable<OpenHashTable<DrillingRecord>>("open", "bytes", TimeHashFunction::bytes);
+	measureTable<HashTable<DrillingRecord>>("chained", "asciiSum", TimeHashFunction::asciiSum);
+	measureTable<OpenHashTable<DrillingRecord>>("open", "asciiSum", TimeHashFunction::asciiSum);
+	return 0;
+}
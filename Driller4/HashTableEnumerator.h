@@ -11,7 +11,7 @@ class HashTableEnumerator : public Enumerator<T>
 {
 private:
 	unsigned long bucket = 0;
-	OULinkedListEnumerator<T>* chainEnumerator = NULL;
+	OULinkedListEnumerator<T> chainEnumerator = OULinkedListEnumerator<T>(nullptr);
 	HashTable<T>* hashTable;
 public:
 	HashTableEnumerator(HashTable<T>* hashTable);
@@ -35,13 +35,15 @@ HashTableEnumerator<T>::HashTableEnumerator(HashTable<T>* hashTable) {
 	}
 	this->hashTable = hashTable;
 
+	//walks the buckets of one table, so any rehash in progress is finished first
+	hashTable->finishRehash();
+
 	//finds first bucket with something
 	while (hashTable->table[bucket]->getSize() == 0) {
 		bucket++;
 	}
 	//sets chain enum to the enumerator in that bucket
-	OULinkedListEnumerator<DrillingRecord> tempEnum = hashTable->table[bucket]->enumerator();
-	chainEnumerator = new OULinkedListEnumerator<DrillingRecord>(tempEnum);
+	chainEnumerator = hashTable->table[bucket]->enumerator();
 }
 
 /*
@@ -49,7 +51,8 @@ Destructor for a hash table enumerator
 */
 template <typename T>
 HashTableEnumerator<T>::~HashTableEnumerator() {
-	delete hashTable;
+
+	//the table belongs to the caller and the chain enumerator is held by value
 	hashTable = nullptr;
 }
 
@@ -60,11 +63,11 @@ template <typename T>
 bool HashTableEnumerator<T>::hasNext() const {
 
 	//checks if at end of linked list and in last bucket
-	if (chainEnumerator->hasNext() == false && bucket == hashTable->getBaseCapacity() - 1) {
+	if (chainEnumerator.hasNext() == false && bucket == hashTable->getBaseCapacity() - 1) {
 		return false;
 	}
 	//checks if at end of linked list and not at last bucket
-	else if (chainEnumerator->hasNext() == false && bucket < hashTable->getBaseCapacity() - 1) {
+	else if (chainEnumerator.hasNext() == false && bucket < hashTable->getBaseCapacity() - 1) {
 
 		//iterate bucket from current one
 		unsigned long tempBucket = bucket;
@@ -73,7 +76,7 @@ bool HashTableEnumerator<T>::hasNext() const {
 		//iterates through the table until it finds a bucket with a linked list
 		while (tempBucket < hashTable->getBaseCapacity()) {
 			
-			OULinkedList<DrillingRecord>* tempList = hashTable->table[tempBucket];
+			OULinkedList<T>* tempList = hashTable->table[tempBucket];
 			//if bucket contains an item return true
 			if (tempList->getSize() != 0) {
 				return true;
@@ -84,7 +87,7 @@ bool HashTableEnumerator<T>::hasNext() const {
 		return false;
 	}
 	//if not at end of linked list return true
-	else if (chainEnumerator->hasNext() == true) {
+	else if (chainEnumerator.hasNext() == true) {
 		return true;
 	}
 	//return false if all tests fail
@@ -102,8 +105,8 @@ T HashTableEnumerator<T>::next() {
 		throw new ExceptionEnumerationBeyondEnd;
 	}
 	//if linked list has next return next
-	else if (chainEnumerator->hasNext() == true) {
-		return chainEnumerator->next();
+	else if (chainEnumerator.hasNext() == true) {
+		return chainEnumerator.next();
 	}
 	//checks if at end of linked list and not at last bucket
 	else {
@@ -121,11 +124,11 @@ T HashTableEnumerator<T>::next() {
 			bucket++;
 		}
 
-		OULinkedList<DrillingRecord>* tempList = hashTable->table[bucket];
+		OULinkedList<T>* tempList = hashTable->table[bucket];
 		//if bucket contains an item return 
 		if (bucket < hashTable->getBaseCapacity()) {
-			*chainEnumerator = tempList->enumerator();
-			return chainEnumerator->next();
+			chainEnumerator = tempList->enumerator();
+			return chainEnumerator.next();
 		}
 		else {
 			throw new ExceptionEnumerationBeyondEnd;
@@ -144,11 +147,11 @@ template <typename T>
 T HashTableEnumerator<T>::peek() const {
 	
 	//checks if at end of linked list and in last bucket
-	if (chainEnumerator->hasNext() == false && bucket == hashTable->getBaseCapacity() - 1) {
+	if (chainEnumerator.hasNext() == false && bucket == hashTable->getBaseCapacity() - 1) {
 		throw new ExceptionEnumerationBeyondEnd;
 	}
 	//checks if at end of linked list and not at last bucket
-	else if (chainEnumerator->hasNext() == false && bucket < hashTable->getBaseCapacity() - 1) {
+	else if (chainEnumerator.hasNext() == false && bucket < hashTable->getBaseCapacity() - 1) {
 
 		//iterate bucket from current one
 		unsigned long tempBucket = bucket;
@@ -157,11 +160,11 @@ T HashTableEnumerator<T>::peek() const {
 		//iterates through the table until it finds a bucket with a linked list
 		while (tempBucket < hashTable->getBaseCapacity()) {
 
-			OULinkedList<DrillingRecord> *tempList = hashTable->table[tempBucket];
+			OULinkedList<T>* tempList = hashTable->table[tempBucket];
 			
 			//if bucket contains an item call linked list peek
 			if (tempList->getSize() != 0) {
-				OULinkedListEnumerator<DrillingRecord> tempEnum = tempList->enumerator();
+				OULinkedListEnumerator<T> tempEnum = tempList->enumerator();
 				return tempEnum.peek();
 			}
 			tempBucket++;
@@ -170,8 +173,8 @@ T HashTableEnumerator<T>::peek() const {
 		throw new ExceptionEnumerationBeyondEnd;
 	}
 	//if not at end of linked list call enum peek
-	else if (chainEnumerator->hasNext() == true) {
-		return chainEnumerator->peek();
+	else if (chainEnumerator.hasNext() == true) {
+		return chainEnumerator.peek();
 	}
 	//throw exception
 	throw new ExceptionEnumerationBeyondEnd;
@@ -0,0 +1,17 @@
+#pragma once
+#ifndef KEY_COMPARATOR_H
+#define KEY_COMPARATOR_H
+
+// KeyComparator is implemented by comparators that can also compare an item against just the key of type K
+// it is ordered by. OULinkedList, AVLTree and HashTable check for it so an item can be looked up by its key
+// without building an item to compare with
+template <typename T, typename K>
+class KeyComparator {
+public:
+	// returns -1 if key orders before item, 0 if item has the key, +1 if key orders after item,
+	// for any item with that key compare gives the same results as compareKey
+	virtual int compareKey(const K& key, const T& item) const = 0;
+	virtual ~KeyComparator() = default;
+};
+
+#endif // !KEY_COMPARATOR_H
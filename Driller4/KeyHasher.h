@@ -0,0 +1,15 @@
+#pragma once
+#ifndef KEY_HASHER_H
+#define KEY_HASHER_H
+
+// KeyHasher is implemented by hashers that can also hash just the key of type K an item is hashed by.
+// HashTable checks for it so an item can be looked up by its key without building an item to hash
+template <typename K>
+class KeyHasher {
+public:
+	// returns the value hash gives any item with this key
+	virtual unsigned long hashKey(const K& key) const = 0;
+	virtual ~KeyHasher() = default;
+};
+
+#endif // !KEY_HASHER_H
@@ -0,0 +1,146 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+/*
+Default constructor, nothing is mapped until open is called
+*/
+MappedFile::MappedFile() {
+}
+
+/*
+Destructor, releases the mapping
+*/
+MappedFile::~MappedFile() {
+	close();
+}
+
+/*
+Method to map the given file into memory
+*/
+bool MappedFile::open(const string& fileName) {
+
+	//releases any file that is already mapped
+	close();
+
+#ifdef _WIN32
+	//opens the file for reading
+	HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	//gets the size of the file
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize)) {
+		CloseHandle(file);
+		return false;
+	}
+	fileHandle = file;
+	size = (size_t)fileSize.QuadPart;
+
+	//an empty file cannot be mapped but is still a valid file
+	if (size == 0) {
+		return true;
+	}
+
+	//creates the mapping and a view of the whole file
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mapping == NULL) {
+		close();
+		return false;
+	}
+	mappingHandle = mapping;
+	data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (data == nullptr) {
+		close();
+		return false;
+	}
+#else
+	//opens the file for reading
+	int file = ::open(fileName.c_str(), O_RDONLY);
+	if (file < 0) {
+		return false;
+	}
+
+	//gets the size of the file and rejects anything that isn't a regular file
+	struct stat fileInfo;
+	if (fstat(file, &fileInfo) != 0 || !S_ISREG(fileInfo.st_mode)) {
+		::close(file);
+		return false;
+	}
+	size = (size_t)fileInfo.st_size;
+
+	//an empty file cannot be mapped but is still a valid file
+	if (size == 0) {
+		::close(file);
+		return true;
+	}
+
+	//maps the whole file, the descriptor is not needed once the mapping exists
+	void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+	::close(file);
+	if (mapping == MAP_FAILED) {
+		size = 0;
+		return false;
+	}
+
+	//the file is read front to back exactly once
+	madvise(mapping, size, MADV_SEQUENTIAL);
+	data = (const char*)mapping;
+#endif
+
+	return true;
+}
+
+/*
+Method to release the mapping
+*/
+void MappedFile::close() {
+
+#ifdef _WIN32
+	if (data != nullptr) {
+		UnmapViewOfFile(data);
+	}
+	if (mappingHandle != nullptr) {
+		CloseHandle((HANDLE)mappingHandle);
+		mappingHandle = nullptr;
+	}
+	if (fileHandle != nullptr) {
+		CloseHandle((HANDLE)fileHandle);
+		fileHandle = nullptr;
+	}
+#else
+	if (data != nullptr) {
+		munmap((void*)data, size);
+	}
+#endif
+
+	data = nullptr;
+	size = 0;
+}
+
+/*
+Method to return a pointer to the mapped bytes
+*/
+const char* MappedFile::getData() const {
+	return data;
+}
+
+/*
+Method to return the number of mapped bytes
+*/
+size_t MappedFile::getSize() const {
+	return size;
+}
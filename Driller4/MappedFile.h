@@ -0,0 +1,32 @@
+#pragma once
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <cstddef>
+
+// MappedFile maps a whole file read-only into memory so it can be tokenized in place
+// without copying each line into its own string
+class MappedFile {
+private:
+	const char* data = nullptr;                        // pointer to the first byte of the mapping
+	std::size_t size = 0;                              // number of bytes in the mapping
+#ifdef _WIN32
+	void* fileHandle = nullptr;                        // handle of the open file
+	void* mappingHandle = nullptr;                     // handle of the file mapping object
+#endif
+public:
+	MappedFile();                                      // creates an object with nothing mapped
+	MappedFile(const MappedFile&) = delete;            // a mapping has a single owner
+	MappedFile& operator=(const MappedFile&) = delete;
+	virtual ~MappedFile();                             // unmaps the file if one is mapped
+
+	// maps the named file and returns true, returns false if the file could not be opened or mapped
+	bool open(const std::string& fileName);
+
+	void close();                                      // unmaps the file, does nothing if no file is mapped
+	const char* getData() const;                       // returns pointer to the start of the mapped bytes
+	std::size_t getSize() const;                       // returns the number of mapped bytes
+};
+
+#endif // !MAPPED_FILE_H
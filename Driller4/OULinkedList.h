@@ -4,6 +4,7 @@
 
 #include "OULink.h"
 #include "Comparator.h"
+#include "KeyComparator.h"
 #include "OULinkedListEnumerator.h"
 
 // OULinkedList stands for Ordered, Unique Linked List. It is a linked list that is always maintained in
@@ -13,11 +14,17 @@ template <typename T>
 class OULinkedList {
 	template <typename U>
 	friend class OULinkedListEnumerator;
+	template <typename U>
+	friend class HashTable;
 private:
 	Comparator<T>* comparator = NULL;               // used to determine list order and item equality
 	unsigned long size = 0;                         // actual number of items currently in list
 	OULink<T>* first = NULL;                        // pointer to first link in list
 	OULink<T>* last = NULL;                         // pointer to last link in list
+	template <typename K>
+	const T* findKeyItem(const K& key, const KeyComparator<T, K>& keyComparator) const;    // item with key, NULL if none
+	template <typename K>
+	const KeyComparator<T, K>& getKeyComparator() const;    // the comparator as a KeyComparator<T, K>
 public:
 	OULinkedList(Comparator<T>* comparator);        // creates empty linked list with comparator
 	virtual ~OULinkedList();                        // deletes all links and their data items
@@ -58,6 +65,18 @@ public:
 	// if an equivalent item is not present, throw a new ExceptionLinkedListAccess
 	T find(T item) const;
 
+	// lookups by a key of type K instead of a whole item, the comparator has to be a KeyComparator<T, K>,
+	// otherwise they throw a new ExceptionLinkedListAccess
+	// if an item with the key is present, return true
+	// if an item with the key is not present, false
+	template <typename K>
+	bool containsKey(const K& key) const;
+
+	// if an item with the key is present, return a copy of that item
+	// if an item with the key is not present, throw a new ExceptionLinkedListAccess
+	template <typename K>
+	T findKey(const K& key) const;
+
 	void clear();                                     // deletes all links in the list, resets size to 0
 
 	unsigned long getSize() const;                    // returns the current number of items in the list
@@ -136,7 +155,8 @@ bool OULinkedList<T>::insert(T item) {
 			//iterates to next link
 			current = current->next;
 		}
-		//else add item to the end of the list
+		//else add item to the end of the list, append makes its own link
+		delete newNode;
 		return append(item);
 	}
 	//if list empty then add at head
@@ -210,17 +230,17 @@ bool OULinkedList<T>::replace(T item) {
 			return true;
 		}
 
-		//iterates through until the current link has no next
+		//iterates through the rest of the links, including the last one
 		while (current->next != nullptr) {
 
+			//iterates links to next
+			current = current->next;
+
 			//if item matches current, replace
 			if (comparator->compare(current->data, item) == 0) {
 				current->data = item;
 				return true;
 			}
-
-			//iterates links to next
-			current = current->next;
 		}
 	}
 	//return false if not in list
@@ -251,6 +271,11 @@ bool OULinkedList<T>::remove(T item) {
 			temp->next = NULL;
 			delete temp;
 			size--;
+
+			//the list is empty if that was the only link
+			if (first == nullptr) {
+				last = nullptr;
+			}
 			return true;
 		}
 
@@ -262,6 +287,9 @@ bool OULinkedList<T>::remove(T item) {
 
 				//pull out nodes, reassign pointers, and delete
 				previous->next = current->next;
+				if (current == last) {
+					last = previous;
+				}
 				current->next = nullptr;
 				delete current;
 				size--;
@@ -401,6 +429,64 @@ T OULinkedList<T>::find(T item) const {
 	}
 }
 
+/*
+Method to return the comparator as one that compares against keys of the given type
+*/
+template <typename T>
+template <typename K>
+const KeyComparator<T, K>& OULinkedList<T>::getKeyComparator() const {
+	const KeyComparator<T, K>* keyComparator = dynamic_cast<const KeyComparator<T, K>*>(comparator);
+	if (keyComparator == nullptr) {
+		throw new ExceptionLinkedListAccess();
+	}
+	return *keyComparator;
+}
+
+/*
+Method to find the item with the given key, the caller supplies the key comparator so a HashTable
+only has to look it up once per lookup
+*/
+template <typename T>
+template <typename K>
+const T* OULinkedList<T>::findKeyItem(const K& key, const KeyComparator<T, K>& keyComparator) const {
+
+	//the list is in order, so the search stops at the first item past the key
+	OULink<T>* current = first;
+	while (current != nullptr) {
+		int comparison = keyComparator.compareKey(key, current->data);
+		if (comparison == 0) {
+			return &current->data;
+		}
+		else if (comparison < 0) {
+			return nullptr;
+		}
+		current = current->next;
+	}
+	return nullptr;
+}
+
+/*
+Method to check if the list contains an item with the given key
+*/
+template <typename T>
+template <typename K>
+bool OULinkedList<T>::containsKey(const K& key) const {
+	return findKeyItem(key, getKeyComparator<K>()) != nullptr;
+}
+
+/*
+Method to find the item with the given key within the list
+*/
+template <typename T>
+template <typename K>
+T OULinkedList<T>::findKey(const K& key) const {
+	const T* item = findKeyItem(key, getKeyComparator<K>());
+	if (item == nullptr) {
+		throw new ExceptionLinkedListAccess();
+	}
+	return *item;
+}
+
 /*
 Method to clear the list and set size to 0
 */
@@ -0,0 +1,446 @@
+#pragma once
+#ifndef OPEN_HASH_TABLE_H
+#define OPEN_HASH_TABLE_H
+
+#include <utility>
+#include <vector>
+#include "Exceptions.h"
+#include "Comparator.h"
+#include "Hasher.h"
+#include "KeyHasher.h"
+#include "KeyComparator.h"
+#include "HashTable.h"
+
+const float MAX_OPEN_LOAD_FACTOR = 0.95f;                       // highest max load factor, every item needs its own slot
+
+// OpenHashTable keeps the HashTable contract (insert, replace, remove, find and the capacity getters) but
+// stores every item inline in one array of slots instead of in a linked list per bucket
+// collisions are resolved by Robin Hood linear probing: an item being placed takes the slot of any item that
+// is closer to its own home bucket, so probe lengths stay short and even, a lookup can stop as soon as it
+// passes an item closer to home than it would be, and removal shifts the following items back one slot
+// instead of leaving tombstones
+// the capacities follow the same SCHEDULE as HashTable and getBucketNumber is still the home bucket, so
+// the bucket dump in hashOutput() works on either table, the enumerator keeps each bucket's items together
+// but its walk starts past the first empty slot, so the open table's buckets don't start from 0
+template <typename T>
+class OpenHashTable {
+	template <typename U>
+	friend class OpenHashTableEnumerator;
+private:
+	Comparator<T>* comparator;                                 // used to determine item equality
+	Hasher<T>* hasher;                                         // used to compute hash value
+	unsigned long size = 0;                                    // actual number of items currently in hash table
+	float maxLoadFactor = DEFAULT_MAX_LOAD_FACTOR;
+	float minLoadFactor = DEFAULT_MIN_LOAD_FACTOR;
+	unsigned int scheduleIndex = DEFAULT_SCHEDULE_INDEX;
+	unsigned long baseCapacity = DEFAULT_BASE_CAPACITY;        // the number of slots
+	T* items = nullptr;                                        // the item in each slot, default constructed if the slot is empty
+	unsigned long* hashes = nullptr;                           // hash of the item in each slot, so probes and resizes don't rehash
+	unsigned long* distances = nullptr;                        // 1 + how far each item is from its home slot, 0 if the slot is empty
+	void allocate(unsigned int newScheduleIndex);              // replaces the slots with empty ones at a capacity from SCHEDULE
+	void resize(unsigned int newScheduleIndex);                // moves every item into slots at a capacity from SCHEDULE
+	void place(T&& item, unsigned long hash);                  // puts an item that is not present into its Robin Hood position
+	long findSlot(const T& item, unsigned long hash) const;    // slot holding an equivalent item, -1 if there is none
+	template <typename K>
+	long findKeySlot(const K& key) const;                      // slot holding an item with key, -1 if there is none
+public:
+	OpenHashTable(Comparator<T>* comparator, Hasher<T>* hasher);        // creates an empty table of DEFAULT_BASE_CAPACITY
+	OpenHashTable(Comparator<T>* comparator, Hasher<T>* hasher,
+		// if size given, creates empty table with size from schedule of sufficient capacity (considering maxLoadFactor)
+		// maxLoadFactor is capped at MAX_OPEN_LOAD_FACTOR so the table always keeps free slots
+		unsigned long size,
+		float maxLoadFactor = DEFAULT_MAX_LOAD_FACTOR,
+		float minLoadFactor = DEFAULT_MIN_LOAD_FACTOR);
+	OpenHashTable(const OpenHashTable<T>&) = delete;           // the slots have a single owner
+	OpenHashTable<T>& operator=(const OpenHashTable<T>&) = delete;
+	virtual ~OpenHashTable();
+
+	// if an equivalent item is not already present, insert item at proper location and return true
+	// if an equivalent item is already present, leave table unchanged and return false
+	// if every slot of the last SCHEDULE capacity is taken, throw a new ExceptionMemoryNotAvailable
+	bool insert(T item);
+
+	// if an equivalent item is already present, replace item and return true
+	// if an equivalent item is not already present, leave table unchanged and return false
+	bool replace(T item);
+
+	// if an equivalent item is already present, remove item and return true
+	// if an equivalent item is not already present, leave table unchanged and return false
+	bool remove(T item);
+
+	// if an equivalent item is present, return a copy of the item
+	// if an equivalent item is not present, throw a new ExceptionHashTableAccess
+	T find(T item) const;
+
+	// lookups by a key of type K instead of a whole item, the hasher has to be a KeyHasher<K> and the
+	// comparator a KeyComparator<T, K>, otherwise they throw a new ExceptionHashTableAccess
+	// if an item with the key is present, return true
+	// if an item with the key is not present, false
+	template <typename K>
+	bool containsKey(const K& key) const;
+
+	// if an item with the key is present, return a copy of the item
+	// if an item with the key is not present, throw a new ExceptionHashTableAccess
+	template <typename K>
+	T findKey(const K& key) const;
+
+	unsigned long getSize() const;                             // returns the current number of items in the table
+	unsigned long getBaseCapacity() const;                     // returns the current number of slots
+	unsigned long getTotalCapacity() const;                    // returns the current number of slots, there are no chains
+	float getLoadFactor() const;                               // returns the current load factor of the table
+	unsigned long getBucketNumber(T item) const;               // returns the home slot of an item
+	unsigned long getMaxProbeLength() const;                   // returns the most slots any lookup of a present item reads
+	HashTableStatistics getStatistics() const;                 // returns how the items are spread over their home slots
+};
+
+/*
+Constructor to create an empty hash table
+*/
+template <typename T>
+OpenHashTable<T>::OpenHashTable(Comparator<T>* comparator, Hasher<T>* hasher) {
+	this->comparator = comparator;
+	this->hasher = hasher;
+	allocate(DEFAULT_SCHEDULE_INDEX);
+}
+
+/*
+Constructor to create a hash table with room for the given number of items
+*/
+template <typename T>
+OpenHashTable<T>::OpenHashTable(Comparator<T>* comparator, Hasher<T>* hasher, unsigned long size, float maxLoadFactor, float minLoadFactor) {
+	this->comparator = comparator;
+	this->hasher = hasher;
+	this->minLoadFactor = minLoadFactor;
+
+	//a chained table can hold more items than buckets but here a full table leaves place nowhere to stop
+	if (maxLoadFactor > MAX_OPEN_LOAD_FACTOR) {
+		maxLoadFactor = MAX_OPEN_LOAD_FACTOR;
+	}
+	this->maxLoadFactor = maxLoadFactor;
+
+	//finds the first capacity in the schedule that holds size items without passing the max load factor
+	unsigned int scheduleNum = 0;
+	while (scheduleNum + 1 < SCHEDULE_SIZE && (float)size > (float)SCHEDULE[scheduleNum] * maxLoadFactor) {
+		scheduleNum++;
+	}
+	allocate(scheduleNum);
+}
+
+/*
+Destructor for the hash table
+*/
+template <typename T>
+OpenHashTable<T>::~OpenHashTable() {
+	delete[] items;
+	delete[] hashes;
+	delete[] distances;
+}
+
+/*
+Method to replace the slots with empty ones
+*/
+template <typename T>
+void OpenHashTable<T>::allocate(unsigned int newScheduleIndex) {
+	delete[] items;
+	delete[] hashes;
+	delete[] distances;
+
+	scheduleIndex = newScheduleIndex;
+	baseCapacity = SCHEDULE[scheduleIndex];
+	items = new T[baseCapacity];
+	hashes = new unsigned long[baseCapacity];
+	distances = new unsigned long[baseCapacity]();
+	size = 0;
+}
+
+/*
+Method to move every item into a new set of slots
+*/
+template <typename T>
+void OpenHashTable<T>::resize(unsigned int newScheduleIndex) {
+
+	//keeps the old slots while the items are moved out of them
+	T* oldItems = items;
+	unsigned long* oldHashes = hashes;
+	unsigned long* oldDistances = distances;
+	unsigned long oldBaseCapacity = baseCapacity;
+	items = nullptr;
+	hashes = nullptr;
+	distances = nullptr;
+	allocate(newScheduleIndex);
+
+	//the stored hashes place each item without hashing it again
+	for (unsigned long i = 0; i < oldBaseCapacity; i++) {
+		if (oldDistances[i] != 0) {
+			place(std::move(oldItems[i]), oldHashes[i]);
+		}
+	}
+
+	delete[] oldItems;
+	delete[] oldHashes;
+	delete[] oldDistances;
+}
+
+/*
+Method to put an item that isn't in the table into its slot
+Walks forward from the home slot and swaps the item being placed with any item closer to its own home,
+then carries on placing the item it took the slot from
+*/
+template <typename T>
+void OpenHashTable<T>::place(T&& item, unsigned long hash) {
+	unsigned long slot = hash % baseCapacity;
+	unsigned long distance = 1;
+
+	while (distances[slot] != 0) {
+		if (distances[slot] < distance) {
+			std::swap(items[slot], item);
+			std::swap(hashes[slot], hash);
+			std::swap(distances[slot], distance);
+		}
+		slot = (slot + 1 == baseCapacity) ? 0 : slot + 1;
+		distance++;
+	}
+
+	items[slot] = std::move(item);
+	hashes[slot] = hash;
+	distances[slot] = distance;
+	size++;
+}
+
+/*
+Method to find the slot of an equivalent item
+*/
+template <typename T>
+long OpenHashTable<T>::findSlot(const T& item, unsigned long hash) const {
+	unsigned long slot = hash % baseCapacity;
+	unsigned long distance = 1;
+
+	//an item closer to its home than the searched one would be means the searched one isn't present
+	while (distances[slot] >= distance) {
+		if (hashes[slot] == hash && comparator->compare(items[slot], item) == 0) {
+			return (long)slot;
+		}
+		slot = (slot + 1 == baseCapacity) ? 0 : slot + 1;
+		distance++;
+	}
+	return -1;
+}
+
+/*
+Method to insert an item into the hash table
+*/
+template <typename T>
+bool OpenHashTable<T>::insert(T item) {
+	unsigned long hash = hasher->hash(item);
+	if (findSlot(item, hash) >= 0) {
+		return false;
+	}
+
+	//grows first if the item would take the table to the max load factor
+	if ((float)(size + 1) >= (float)baseCapacity * maxLoadFactor && scheduleIndex + 1 < SCHEDULE_SIZE) {
+		resize(scheduleIndex + 1);
+	}
+
+	//the largest table can't grow, so once its slots run out there is nowhere to put the item
+	if (size >= baseCapacity) {
+		throw new ExceptionMemoryNotAvailable();
+	}
+	place(std::move(item), hash);
+	return true;
+}
+
+/*
+Method to replace an item in the hash table
+*/
+template <typename T>
+bool OpenHashTable<T>::replace(T item) {
+	long slot = findSlot(item, hasher->hash(item));
+	if (slot < 0) {
+		return false;
+	}
+	items[slot] = std::move(item);
+	return true;
+}
+
+/*
+Method to remove an item from the hash table
+Shifts each following item that isn't in its home slot back one slot, so no lookup has to step over a gap
+*/
+template <typename T>
+bool OpenHashTable<T>::remove(T item) {
+	long found = findSlot(item, hasher->hash(item));
+	if (found < 0) {
+		return false;
+	}
+
+	unsigned long slot = (unsigned long)found;
+	unsigned long next = (slot + 1 == baseCapacity) ? 0 : slot + 1;
+	while (distances[next] > 1) {
+		items[slot] = std::move(items[next]);
+		hashes[slot] = hashes[next];
+		distances[slot] = distances[next] - 1;
+		slot = next;
+		next = (next + 1 == baseCapacity) ? 0 : next + 1;
+	}
+
+	//resets the freed slot so it lets go of anything it owns
+	items[slot] = T();
+	distances[slot] = 0;
+	size--;
+
+	//shrinks if the load factor is too low
+	if (getLoadFactor() <= minLoadFactor && scheduleIndex > 0) {
+		resize(scheduleIndex - 1);
+	}
+	return true;
+}
+
+/*
+Method to find an item in the hash table
+*/
+template <typename T>
+T OpenHashTable<T>::find(T item) const {
+	long slot = findSlot(item, hasher->hash(item));
+	if (slot < 0) {
+		throw new ExceptionHashTableAccess;
+	}
+	return items[slot];
+}
+
+/*
+Method to find the slot of an item by its key
+*/
+template <typename T>
+template <typename K>
+long OpenHashTable<T>::findKeySlot(const K& key) const {
+
+	//checks the hasher and comparator can both work from a key of this type
+	const KeyHasher<K>* keyHasher = dynamic_cast<const KeyHasher<K>*>(hasher);
+	const KeyComparator<T, K>* keyComparator = dynamic_cast<const KeyComparator<T, K>*>(comparator);
+	if (keyHasher == nullptr || keyComparator == nullptr) {
+		throw new ExceptionHashTableAccess;
+	}
+
+	//probes exactly like findSlot
+	unsigned long hash = keyHasher->hashKey(key);
+	unsigned long slot = hash % baseCapacity;
+	unsigned long distance = 1;
+	while (distances[slot] >= distance) {
+		if (hashes[slot] == hash && keyComparator->compareKey(key, items[slot]) == 0) {
+			return (long)slot;
+		}
+		slot = (slot + 1 == baseCapacity) ? 0 : slot + 1;
+		distance++;
+	}
+	return -1;
+}
+
+/*
+Method to check if the hash table contains an item with the given key
+*/
+template <typename T>
+template <typename K>
+bool OpenHashTable<T>::containsKey(const K& key) const {
+	return findKeySlot(key) >= 0;
+}
+
+/*
+Method to find an item in the hash table by its key
+*/
+template <typename T>
+template <typename K>
+T OpenHashTable<T>::findKey(const K& key) const {
+	long slot = findKeySlot(key);
+	if (slot < 0) {
+		throw new ExceptionHashTableAccess;
+	}
+	return items[slot];
+}
+
+/*
+Method to return size of the hash table
+*/
+template <typename T>
+unsigned long OpenHashTable<T>::getSize() const {
+	return size;
+}
+
+/*
+Method to return the base capacity of the table
+*/
+template <typename T>
+unsigned long OpenHashTable<T>::getBaseCapacity() const {
+	return baseCapacity;
+}
+
+/*
+Method to return the total capacity of the table, the same as the base capacity since there are no chains
+*/
+template <typename T>
+unsigned long OpenHashTable<T>::getTotalCapacity() const {
+	return baseCapacity;
+}
+
+/*
+Method to return the load factor of the table
+*/
+template <typename T>
+float OpenHashTable<T>::getLoadFactor() const {
+	return (float)size / (float)baseCapacity;
+}
+
+/*
+Method to return the home slot of a given item
+*/
+template <typename T>
+unsigned long OpenHashTable<T>::getBucketNumber(T item) const {
+	return hasher->hash(item) % baseCapacity;
+}
+
+/*
+Method to return the longest probe, the distance of the item furthest from its home slot
+*/
+template <typename T>
+unsigned long OpenHashTable<T>::getMaxProbeLength() const {
+	unsigned long longest = 0;
+	for (unsigned long i = 0; i < baseCapacity; i++) {
+		if (distances[i] > longest) {
+			longest = distances[i];
+		}
+	}
+	return longest;
+}
+
+/*
+Method to measure how evenly the items are spread over their home slots, each home slot counts as the
+bucket a chained table would have put the item in
+*/
+template <typename T>
+HashTableStatistics OpenHashTable<T>::getStatistics() const {
+	HashTableStatistics statistics;
+	statistics.meanChain = (double)size / (double)baseCapacity;
+
+	//counts the items whose home is each slot
+	std::vector<unsigned long> chains(baseCapacity, 0);
+	for (unsigned long i = 0; i < baseCapacity; i++) {
+		if (distances[i] != 0) {
+			chains[hashes[i] % baseCapacity]++;
+		}
+	}
+
+	//sums the squared distance of each count from the mean
+	double squares = 0.0;
+	for (unsigned long i = 0; i < baseCapacity; i++) {
+		if (chains[i] > 0) {
+			statistics.usedBuckets++;
+		}
+		if (chains[i] > statistics.longestChain) {
+			statistics.longestChain = chains[i];
+		}
+		squares += ((double)chains[i] - statistics.meanChain) * ((double)chains[i] - statistics.meanChain);
+	}
+	statistics.chainVariance = squares / (double)baseCapacity;
+	return statistics;
+}
+
+#endif // !OPEN_HASH_TABLE_H
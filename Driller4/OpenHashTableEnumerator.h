@@ -0,0 +1,108 @@
+#pragma once
+#ifndef OPEN_HASH_TABLE_ENUMERATOR_H
+#define OPEN_HASH_TABLE_ENUMERATOR_H
+
+#include "Enumerator.h"
+#include "Exceptions.h"
+#include "OpenHashTable.h"
+
+// enumerates the items of an OpenHashTable in slot order, so items with the same home slot come out together
+// a run of items can wrap from the last slot to the first, so the walk starts just past the first empty slot,
+// where a run always begins, and wraps around once
+template <typename T>
+class OpenHashTableEnumerator : public Enumerator<T>
+{
+private:
+	unsigned long start = 0;                                   // the slot the walk starts at
+	unsigned long position = 0;                                // slots walked past start, the next item is at start + position
+	OpenHashTable<T>* hashTable;
+	unsigned long slot() const;                                // the slot of the next item
+	void skipEmpty();                                          // moves position forward to the next item, or to the end
+public:
+	OpenHashTableEnumerator(OpenHashTable<T>* hashTable);      // throws ExceptionHashTableAccess if the table is empty
+	virtual ~OpenHashTableEnumerator();
+	bool hasNext() const;
+	T next();              // throws ExceptionEnumerationBeyondEnd if no next item is available
+	T peek() const;        // throws ExceptionEnumerationBeyondEnd if no next item is available
+};
+
+/*
+Constructor for an enumerator over an open hash table
+*/
+template <typename T>
+OpenHashTableEnumerator<T>::OpenHashTableEnumerator(OpenHashTable<T>* hashTable) {
+
+	//checks if hash table is empty or a null pointer
+	if (hashTable == nullptr || hashTable->getSize() == 0) {
+		throw new ExceptionHashTableAccess();
+	}
+	this->hashTable = hashTable;
+
+	//starts past the first empty slot, there is one since the table is never full
+	while (start < hashTable->baseCapacity && hashTable->distances[start] != 0) {
+		start++;
+	}
+	start = (start + 1) % hashTable->baseCapacity;
+	skipEmpty();
+}
+
+/*
+Destructor, the table belongs to the caller
+*/
+template <typename T>
+OpenHashTableEnumerator<T>::~OpenHashTableEnumerator() {
+	hashTable = nullptr;
+}
+
+/*
+Method to return the slot of the next item
+*/
+template <typename T>
+unsigned long OpenHashTableEnumerator<T>::slot() const {
+	return (start + position) % hashTable->baseCapacity;
+}
+
+/*
+Method to move to the next slot holding an item
+*/
+template <typename T>
+void OpenHashTableEnumerator<T>::skipEmpty() {
+	while (position < hashTable->baseCapacity && hashTable->distances[slot()] == 0) {
+		position++;
+	}
+}
+
+/*
+Method to see if there is another item
+*/
+template <typename T>
+bool OpenHashTableEnumerator<T>::hasNext() const {
+	return position < hashTable->baseCapacity;
+}
+
+/*
+Method to return the next item and move past it
+*/
+template <typename T>
+T OpenHashTableEnumerator<T>::next() {
+	if (!hasNext()) {
+		throw new ExceptionEnumerationBeyondEnd;
+	}
+	T item = hashTable->items[slot()];
+	position++;
+	skipEmpty();
+	return item;
+}
+
+/*
+Method to return the next item without moving past it
+*/
+template <typename T>
+T OpenHashTableEnumerator<T>::peek() const {
+	if (!hasNext()) {
+		throw new ExceptionEnumerationBeyondEnd;
+	}
+	return hashTable->items[slot()];
+}
+
+#endif // !OPEN_HASH_TABLE_ENUMERATOR_H
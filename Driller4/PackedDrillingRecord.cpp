@@ -0,0 +1,209 @@
+#include "PackedDrillingRecord.h"
+#include "Exceptions.h"
+#include <deque>
+#include <iomanip>
+
+using namespace std;
+
+//every distinct date seen by pack or getDateId, the position in the table is the date id
+//id 0 is the empty date, so a record that was never packed prints an empty date like a new DrillingRecord
+//a deque never moves its strings when it grows, so the references getDate hands out stay valid
+static deque<string>& dateTable() {
+	static deque<string> dates(1);
+	return dates;
+}
+
+/*
+Method to pack a full record, fails if its time stamp can't be stored as seconds since midnight
+*/
+bool PackedDrillingRecord::pack(const DrillingRecord& record, PackedDrillingRecord& packed) {
+
+	//checks the time first so packed is left alone on failure
+	unsigned int timeKey = 0;
+	if (!parseTime(record.getString(1), timeKey)) {
+		return false;
+	}
+
+	packed.dateId = getDateId(record.getString(0));
+	packed.timeKey = timeKey;
+	for (unsigned int i = 0; i < MAX_NUMS; i++) {
+		packed.nums[i] = record.getNum(i);
+	}
+	return true;
+}
+
+/*
+Method to rebuild the full record
+*/
+DrillingRecord PackedDrillingRecord::unpack() const {
+
+	DrillingRecord record;
+	record.addString(getDate(dateId));
+	record.addString(formatTime(timeKey));
+	for (unsigned int i = 0; i < MAX_NUMS; i++) {
+		record.addNum(nums[i]);
+	}
+	return record;
+}
+
+/*
+Method to look up the id of a date, dates are added to the table the first time they are seen
+*/
+unsigned int PackedDrillingRecord::getDateId(string_view date) {
+
+	//a data file only ever has one date so this search is almost always one comparison
+	deque<string>& dates = dateTable();
+	for (unsigned int i = 0; i < dates.size(); i++) {
+		if (dates[i] == date) {
+			return i;
+		}
+	}
+	dates.emplace_back(date);
+	return (unsigned int)dates.size() - 1;
+}
+
+/*
+Method to return the date with the given id
+*/
+const string& PackedDrillingRecord::getDate(unsigned int dateId) {
+
+	deque<string>& dates = dateTable();
+	if (dateId < dates.size()) {
+		return dates[dateId];
+	}
+
+	//ids that were never handed out print the same empty date as id 0
+	return dates[0];
+}
+
+/*
+Method to convert HH:MM:SS to seconds since midnight
+*/
+bool PackedDrillingRecord::parseTime(string_view time, unsigned int& timeKey) {
+
+	//only exactly HH:MM:SS can be turned back into the same text
+	if (time.size() != 8 || time[2] != ':' || time[5] != ':') {
+		return false;
+	}
+	for (unsigned int i : { 0, 1, 3, 4, 6, 7 }) {
+		if (time[i] < '0' || time[i] > '9') {
+			return false;
+		}
+	}
+
+	unsigned int hours = (time[0] - '0') * 10 + (time[1] - '0');
+	unsigned int minutes = (time[3] - '0') * 10 + (time[4] - '0');
+	unsigned int seconds = (time[6] - '0') * 10 + (time[7] - '0');
+	if (hours > 23 || minutes > 59 || seconds > 59) {
+		return false;
+	}
+
+	timeKey = hours * 3600 + minutes * 60 + seconds;
+	return true;
+}
+
+/*
+Method to convert seconds since midnight back to HH:MM:SS
+*/
+string PackedDrillingRecord::formatTime(unsigned int timeKey) {
+
+	unsigned int hours = timeKey / 3600;
+	unsigned int minutes = (timeKey / 60) % 60;
+	unsigned int seconds = timeKey % 60;
+
+	string time = "00:00:00";
+	time[0] = (char)('0' + hours / 10);
+	time[1] = (char)('0' + hours % 10);
+	time[3] = (char)('0' + minutes / 10);
+	time[4] = (char)('0' + minutes % 10);
+	time[6] = (char)('0' + seconds / 10);
+	time[7] = (char)('0' + seconds % 10);
+	return time;
+}
+
+/*
+Method to return the date id
+*/
+unsigned int PackedDrillingRecord::getDateId() const {
+	return dateId;
+}
+
+/*
+Method to return the seconds since midnight
+*/
+unsigned int PackedDrillingRecord::getTimeKey() const {
+	return timeKey;
+}
+
+/*
+Method to return the date or time as text, in the same columns as DrillingRecord::getString
+*/
+string PackedDrillingRecord::getString(unsigned int index) const {
+
+	if (index == 0) {
+		return getDate(dateId);
+	}
+	else if (index == 1) {
+		return formatTime(timeKey);
+	}
+	else {
+		throw new ExceptionIndexOutOfRange();
+	}
+}
+
+/*
+Method to set the date id
+*/
+void PackedDrillingRecord::setDateId(unsigned int dateId) {
+	this->dateId = dateId;
+}
+
+/*
+Method to set the seconds since midnight
+*/
+void PackedDrillingRecord::setTimeKey(unsigned int timeKey) {
+	this->timeKey = timeKey;
+}
+
+/*
+Returns the double at the given index
+*/
+double PackedDrillingRecord::getNum(unsigned int index) const {
+
+	if (index < MAX_NUMS) {
+		return nums[index];
+	}
+	else {
+		throw new ExceptionIndexOutOfRange();
+	}
+}
+
+/*
+Method to set the number at a given place in the record
+*/
+void PackedDrillingRecord::setNum(double num, unsigned int index) {
+
+	if (index < MAX_NUMS) {
+		nums[index] = num;
+	}
+	else {
+		throw new ExceptionIndexOutOfRange();
+	}
+}
+
+/*
+Overloaded ostream operator, output matches a fully populated DrillingRecord
+*/
+ostream& operator<<(ostream& os, const PackedDrillingRecord& record) {
+
+	os << PackedDrillingRecord::getDate(record.dateId) << ";" << PackedDrillingRecord::formatTime(record.timeKey) << ";";
+	for (unsigned int i = 0; i < MAX_NUMS; i++) {
+		if (i == MAX_NUMS - 1) {
+			os << fixed << setprecision(2) << record.nums[i];
+		}
+		else {
+			os << fixed << setprecision(2) << record.nums[i] << ";";
+		}
+	}
+	return os;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#ifndef PACKED_DRILLING_RECORD_H
+#define PACKED_DRILLING_RECORD_H
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include "DrillingRecord.h"
+
+// PackedDrillingRecord holds the same data as a full DrillingRecord without any strings: the date is an id
+// into a shared table of dates and the HH:MM:SS time is stored as seconds since midnight
+// it is trivially copyable, so containers can move it around with plain memory copies
+class PackedDrillingRecord {
+
+	// overloaded output operator that prints the record exactly like the DrillingRecord operator<<
+	friend std::ostream& operator<<(std::ostream& os, const PackedDrillingRecord& record);
+
+private:
+	unsigned int dateId = 0;                                   // position of the date in the date table, 0 is the empty date
+	unsigned int timeKey = 0;                                  // seconds since midnight
+	double nums[MAX_NUMS] = {};                                // holds the numeric data, in column order
+public:
+	PackedDrillingRecord() = default;                          // empty date, midnight, all nums 0.0
+
+	// packs a fully populated record, returns false (leaving packed unchanged) if the time isn't HH:MM:SS
+	static bool pack(const DrillingRecord& record, PackedDrillingRecord& packed);
+	DrillingRecord unpack() const;                             // returns the equivalent full record
+
+	// date table shared by every packed record, not safe to add dates from several threads at once
+	static unsigned int getDateId(std::string_view date);      // returns the id of date, adding it if needed
+	static const std::string& getDate(unsigned int dateId);    // returns the date with the given id
+
+	// converts between HH:MM:SS and seconds since midnight, parse returns false if time isn't HH:MM:SS
+	static bool parseTime(std::string_view time, unsigned int& timeKey);
+	static std::string formatTime(unsigned int timeKey);
+
+	unsigned int getDateId() const;                            // returns the date id
+	unsigned int getTimeKey() const;                           // returns the seconds since midnight
+	std::string getString(unsigned int index) const;           // returns the date (0) or time (1) as text
+	void setDateId(unsigned int dateId);                       // sets the date id
+	void setTimeKey(unsigned int timeKey);                     // sets the seconds since midnight
+
+	// the following member functions must throw new ExceptionIndexOutOfRange if index is too large
+	double getNum(unsigned int index) const;                   // returns (copy of) num at index in num array
+	void setNum(double num, unsigned int index);               // sets nums[index] to num
+};
+
+static_assert(std::is_trivially_copyable<PackedDrillingRecord>::value, "PackedDrillingRecord must stay trivially copyable");
+
+#endif // !PACKED_DRILLING_RECORD_H
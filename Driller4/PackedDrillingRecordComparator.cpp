@@ -0,0 +1,47 @@
+#include "PackedDrillingRecordComparator.h"
+
+/*
+Constructor for a packed record comparator that takes a column as a parameter
+*/
+PackedDrillingRecordComparator::PackedDrillingRecordComparator(unsigned int column) {
+	this->column = column;
+}
+
+/*
+Method to compare two PackedDrillingRecord objects
+*/
+int PackedDrillingRecordComparator::compare(const PackedDrillingRecord& item1, const PackedDrillingRecord& item2) const {
+
+	//dates only need their text compared when the ids differ
+	if (column == 0) {
+		if (item1.getDateId() == item2.getDateId()) {
+			return 0;
+		}
+		int result = PackedDrillingRecord::getDate(item1.getDateId()).compare(PackedDrillingRecord::getDate(item2.getDateId()));
+		return (result < 0) ? -1 : (result > 0) ? 1 : 0;
+	}
+
+	//HH:MM:SS text sorts the same as seconds since midnight
+	else if (column == 1) {
+		if (item1.getTimeKey() < item2.getTimeKey()) {
+			return -1;
+		}
+		return (item1.getTimeKey() > item2.getTimeKey()) ? 1 : 0;
+	}
+
+	//numeric columns compare the same as in DrillingRecordComparator
+	else {
+		double num1 = item1.getNum(column - 2);
+		double num2 = item2.getNum(column - 2);
+		if (num1 < num2) {
+			return -1;
+		}
+		else if (num1 == num2) {
+			return 0;
+		}
+		else if (num1 > num2) {
+			return 1;
+		}
+	}
+	return -2;
+}
@@ -0,0 +1,19 @@
+#pragma once
+#ifndef PACKED_DRILLING_RECORD_COMPARATOR_H
+#define PACKED_DRILLING_RECORD_COMPARATOR_H
+
+#include "Comparator.h"
+#include "PackedDrillingRecord.h"
+
+// orders packed records by one column, the same way DrillingRecordComparator orders full records
+class PackedDrillingRecordComparator : public Comparator<PackedDrillingRecord> {
+private:
+	unsigned int column = 0;
+public:
+	PackedDrillingRecordComparator(unsigned int column);
+
+	// returns -1 if item1 < item2, 0 if item1 == item2, +1 if item1 > item2
+	int compare(const PackedDrillingRecord& item1, const PackedDrillingRecord& item2) const;
+};
+
+#endif // !PACKED_DRILLING_RECORD_COMPARATOR_H
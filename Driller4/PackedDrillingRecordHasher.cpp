@@ -0,0 +1,11 @@
+#include "PackedDrillingRecordHasher.h"
+
+/*
+Method to calculate the hash value of the given item's time
+*/
+unsigned long PackedDrillingRecordHasher::hash(const PackedDrillingRecord& item) const {
+
+	//seconds since midnight are already distinct for every time stamp, and the table takes them
+	//modulo a prime so consecutive seconds land in consecutive buckets
+	return (unsigned long)item.getTimeKey();
+}
@@ -0,0 +1,14 @@
+#pragma once
+#ifndef PACKED_DRILLING_RECORD_HASHER_H
+#define PACKED_DRILLING_RECORD_HASHER_H
+
+#include "Hasher.h"
+#include "PackedDrillingRecord.h"
+
+// hashes a packed record by its time, the same key DrillingRecordHasher uses
+class PackedDrillingRecordHasher : public Hasher<PackedDrillingRecord> {
+public:
+	unsigned long hash(const PackedDrillingRecord& item) const;
+};
+
+#endif //!PACKED_DRILLING_RECORD_HASHER_H
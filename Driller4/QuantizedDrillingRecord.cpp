@@ -0,0 +1,226 @@
+#include "QuantizedDrillingRecord.h"
+#include "Exceptions.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+
+using namespace std;
+
+ChannelEncoding QuantizedDrillingRecord::encodings[MAX_NUMS] = {};
+bool QuantizedDrillingRecord::encodingsInUse = false;
+
+/*
+Function to find the value x 100 that two decimal output shows for num
+*/
+static bool toHundredths(double num, long long& hundredths) {
+
+	double scaled = num * 100.0;
+	if (!(fabs(scaled) < 9.0e15)) {
+		return false;
+	}
+
+	//rounding the scaled value agrees with the printed digits except right at a half, where printing
+	//decides from the exact binary value, so those few values are formatted to get the digits
+	hundredths = llround(scaled);
+	if (fabs(fabs(scaled - trunc(scaled)) - 0.5) < 1e-6) {
+		char buffer[64];
+		snprintf(buffer, sizeof(buffer), "%.2f", num);
+		char* point = buffer;
+		long long whole = strtoll(buffer, &point, 10);
+		long long fraction = (point[0] == '.') ? (point[1] - '0') * 10 + (point[2] - '0') : 0;
+		hundredths = (buffer[0] == '-') ? whole * 100 - fraction : whole * 100 + fraction;
+	}
+	return true;
+}
+
+/*
+Method to store num in a channel, returns false if that would change its two decimal output
+*/
+bool QuantizedDrillingRecord::encode(double num, unsigned int index, Channel& channel) {
+
+	long long hundredths = 0;
+	if (!toHundredths(num, hundredths)) {
+		return false;
+	}
+
+	//fixed2 keeps exactly the printed digits as long as they fit in 32 bits, except a -0.00 which it can't show
+	if (encodings[index] == ChannelEncoding::fixed2) {
+		if (hundredths < INT32_MIN || hundredths > INT32_MAX || (hundredths == 0 && signbit(num))) {
+			return false;
+		}
+		channel.fixed = (int32_t)hundredths;
+		encodingsInUse = true;
+		return true;
+	}
+
+	//float32 is accepted only if the float still prints the same digits
+	float single = (float)num;
+	long long singleHundredths = 0;
+	if (!toHundredths((double)single, singleHundredths) || singleHundredths != hundredths) {
+		return false;
+	}
+	channel.single = single;
+	encodingsInUse = true;
+	return true;
+}
+
+/*
+Method to select how a channel is stored
+*/
+bool QuantizedDrillingRecord::setEncoding(unsigned int index, ChannelEncoding encoding) {
+
+	if (index >= MAX_NUMS) {
+		throw new ExceptionIndexOutOfRange();
+	}
+
+	//stored values don't record their encoding, so changing it would reinterpret their bits
+	if (encodingsInUse && encodings[index] != encoding) {
+		return false;
+	}
+	encodings[index] = encoding;
+	return true;
+}
+
+/*
+Method to return how a channel is stored
+*/
+ChannelEncoding QuantizedDrillingRecord::getEncoding(unsigned int index) {
+
+	if (index < MAX_NUMS) {
+		return encodings[index];
+	}
+	else {
+		throw new ExceptionIndexOutOfRange();
+	}
+}
+
+/*
+Method to quantize a packed record
+*/
+bool QuantizedDrillingRecord::pack(const PackedDrillingRecord& record, QuantizedDrillingRecord& quantized) {
+
+	//encodes into a temporary so quantized is left alone on failure
+	QuantizedDrillingRecord result;
+	result.dateId = record.getDateId();
+	result.timeKey = record.getTimeKey();
+	for (unsigned int i = 0; i < MAX_NUMS; i++) {
+		if (!encode(record.getNum(i), i, result.nums[i])) {
+			return false;
+		}
+	}
+	quantized = result;
+	return true;
+}
+
+/*
+Method to quantize a full record
+*/
+bool QuantizedDrillingRecord::pack(const DrillingRecord& record, QuantizedDrillingRecord& quantized) {
+
+	PackedDrillingRecord packed;
+	return PackedDrillingRecord::pack(record, packed) && pack(packed, quantized);
+}
+
+/*
+Method to rebuild the packed record
+*/
+PackedDrillingRecord QuantizedDrillingRecord::unpack() const {
+
+	PackedDrillingRecord packed;
+	packed.setDateId(dateId);
+	packed.setTimeKey(timeKey);
+	for (unsigned int i = 0; i < MAX_NUMS; i++) {
+		packed.setNum(getNum(i), i);
+	}
+	return packed;
+}
+
+/*
+Method to return the date id
+*/
+unsigned int QuantizedDrillingRecord::getDateId() const {
+	return dateId;
+}
+
+/*
+Method to return the seconds since midnight
+*/
+unsigned int QuantizedDrillingRecord::getTimeKey() const {
+	return timeKey;
+}
+
+/*
+Method to return the raw value x 100 of a fixed2 channel
+*/
+int32_t QuantizedDrillingRecord::getFixed(unsigned int index) const {
+
+	if (index >= MAX_NUMS || encodings[index] != ChannelEncoding::fixed2) {
+		throw new ExceptionIndexOutOfRange();
+	}
+	return nums[index].fixed;
+}
+
+/*
+Method to return the raw value of a float32 channel
+*/
+float QuantizedDrillingRecord::getSingle(unsigned int index) const {
+
+	if (index >= MAX_NUMS || encodings[index] != ChannelEncoding::float32) {
+		throw new ExceptionIndexOutOfRange();
+	}
+	return nums[index].single;
+}
+
+/*
+Returns the stored value of a channel as a double
+*/
+double QuantizedDrillingRecord::getNum(unsigned int index) const {
+
+	if (index >= MAX_NUMS) {
+		throw new ExceptionIndexOutOfRange();
+	}
+	if (encodings[index] == ChannelEncoding::fixed2) {
+		return nums[index].fixed / 100.0;
+	}
+	return (double)nums[index].single;
+}
+
+/*
+Method to store the number at a given place in the record
+*/
+bool QuantizedDrillingRecord::setNum(double num, unsigned int index) {
+
+	if (index >= MAX_NUMS) {
+		throw new ExceptionIndexOutOfRange();
+	}
+	return encode(num, index, nums[index]);
+}
+
+/*
+Overloaded ostream operator, output matches a fully populated DrillingRecord
+*/
+ostream& operator<<(ostream& os, const QuantizedDrillingRecord& record) {
+
+	os << PackedDrillingRecord::getDate(record.dateId) << ";" << PackedDrillingRecord::formatTime(record.timeKey) << ";";
+	for (unsigned int i = 0; i < MAX_NUMS; i++) {
+
+		//fixed2 channels already hold the printed digits so they are written straight out
+		if (QuantizedDrillingRecord::encodings[i] == ChannelEncoding::fixed2) {
+			long long value = record.nums[i].fixed;
+			long long magnitude = (value < 0) ? -value : value;
+			if (value < 0) {
+				os << '-';
+			}
+			os << magnitude / 100 << '.' << (char)('0' + (magnitude % 100) / 10) << (char)('0' + magnitude % 10);
+		}
+		else {
+			os << fixed << setprecision(2) << (double)record.nums[i].single;
+		}
+
+		if (i != MAX_NUMS - 1) {
+			os << ";";
+		}
+	}
+	return os;
+}
@@ -0,0 +1,65 @@
+#pragma once
+#ifndef QUANTIZED_DRILLING_RECORD_H
+#define QUANTIZED_DRILLING_RECORD_H
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include "DrillingRecord.h"
+#include "PackedDrillingRecord.h"
+
+// how a sensor channel is stored in a QuantizedDrillingRecord
+// fixed2 keeps value x 100 as a 32 bit integer, float32 keeps the value as a 4 byte float
+enum class ChannelEncoding : int { fixed2, float32 };
+
+// QuantizedDrillingRecord is a PackedDrillingRecord whose 16 channels take 4 bytes each instead of 8
+// output only ever shows two decimals, so a value is accepted only if storing it doesn't change that output
+// the encoding of each channel is shared by every quantized record and can only be chosen before any are packed
+class QuantizedDrillingRecord {
+
+	// overloaded output operator that prints the record exactly like the DrillingRecord operator<<
+	friend std::ostream& operator<<(std::ostream& os, const QuantizedDrillingRecord& record);
+
+private:
+	union Channel {
+		std::int32_t fixed;                                    // value x 100, for fixed2 channels
+		float single;                                          // value, for float32 channels
+	};
+
+	unsigned int dateId = 0;                                   // position of the date in the PackedDrillingRecord date table
+	unsigned int timeKey = 0;                                  // seconds since midnight
+	Channel nums[MAX_NUMS] = {};                               // holds the numeric data, in column order
+
+	static ChannelEncoding encodings[MAX_NUMS];                // encoding of each channel, fixed2 by default
+	static bool encodingsInUse;                                // true once any value has been stored in a channel
+	static bool encode(double num, unsigned int index, Channel& channel);   // stores num if its output is unchanged
+public:
+	QuantizedDrillingRecord() = default;                       // date id 0, midnight, all nums 0
+
+	// selects how a channel is stored, throws new ExceptionIndexOutOfRange if index is too large
+	// returns false (leaving the encoding unchanged) once any record has been packed, since the values
+	// already stored would be read back in the wrong encoding
+	static bool setEncoding(unsigned int index, ChannelEncoding encoding);
+	static ChannelEncoding getEncoding(unsigned int index);
+
+	// packs a record, returns false (leaving quantized unchanged) if the time isn't HH:MM:SS or a value
+	// can't be stored in its channel's encoding without changing its two decimal output
+	static bool pack(const PackedDrillingRecord& record, QuantizedDrillingRecord& quantized);
+	static bool pack(const DrillingRecord& record, QuantizedDrillingRecord& quantized);
+	PackedDrillingRecord unpack() const;                       // returns the equivalent packed record
+
+	unsigned int getDateId() const;                            // returns the date id
+	unsigned int getTimeKey() const;                           // returns the seconds since midnight
+
+	// the following member functions must throw new ExceptionIndexOutOfRange if index is too large
+	// getFixed and getSingle also throw it if the channel is stored in the other encoding
+	std::int32_t getFixed(unsigned int index) const;           // returns the raw value x 100 of a fixed2 channel
+	float getSingle(unsigned int index) const;                 // returns the raw value of a float32 channel
+	double getNum(unsigned int index) const;                   // returns the stored value of a channel
+	bool setNum(double num, unsigned int index);               // stores num, returns false if its output would change
+};
+
+static_assert(std::is_trivially_copyable<QuantizedDrillingRecord>::value, "QuantizedDrillingRecord must stay trivially copyable");
+
+#endif // !QUANTIZED_DRILLING_RECORD_H
@@ -0,0 +1,55 @@
+#include "QuantizedDrillingRecordComparator.h"
+#include <cstdint>
+
+/*
+Constructor for a quantized record comparator that takes a column as a parameter
+*/
+QuantizedDrillingRecordComparator::QuantizedDrillingRecordComparator(unsigned int column) {
+	this->column = column;
+}
+
+/*
+Method to compare two QuantizedDrillingRecord objects
+*/
+int QuantizedDrillingRecordComparator::compare(const QuantizedDrillingRecord& item1, const QuantizedDrillingRecord& item2) const {
+
+	//dates only need their text compared when the ids differ
+	if (column == 0) {
+		if (item1.getDateId() == item2.getDateId()) {
+			return 0;
+		}
+		int result = PackedDrillingRecord::getDate(item1.getDateId()).compare(PackedDrillingRecord::getDate(item2.getDateId()));
+		return (result < 0) ? -1 : (result > 0) ? 1 : 0;
+	}
+
+	//HH:MM:SS text sorts the same as seconds since midnight
+	else if (column == 1) {
+		if (item1.getTimeKey() < item2.getTimeKey()) {
+			return -1;
+		}
+		return (item1.getTimeKey() > item2.getTimeKey()) ? 1 : 0;
+	}
+
+	//fixed2 channels compare their scaled integers
+	else if (QuantizedDrillingRecord::getEncoding(column - 2) == ChannelEncoding::fixed2) {
+		int32_t num1 = item1.getFixed(column - 2);
+		int32_t num2 = item2.getFixed(column - 2);
+		return (num1 < num2) ? -1 : (num1 > num2) ? 1 : 0;
+	}
+
+	//float32 channels compare their floats
+	else {
+		float num1 = item1.getSingle(column - 2);
+		float num2 = item2.getSingle(column - 2);
+		if (num1 < num2) {
+			return -1;
+		}
+		else if (num1 == num2) {
+			return 0;
+		}
+		else if (num1 > num2) {
+			return 1;
+		}
+	}
+	return -2;
+}
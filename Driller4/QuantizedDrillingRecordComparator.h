@@ -0,0 +1,19 @@
+#pragma once
+#ifndef QUANTIZED_DRILLING_RECORD_COMPARATOR_H
+#define QUANTIZED_DRILLING_RECORD_COMPARATOR_H
+
+#include "Comparator.h"
+#include "QuantizedDrillingRecord.h"
+
+// orders quantized records by one column, fixed2 channels compare as integers
+class QuantizedDrillingRecordComparator : public Comparator<QuantizedDrillingRecord> {
+private:
+	unsigned int column = 0;
+public:
+	QuantizedDrillingRecordComparator(unsigned int column);
+
+	// returns -1 if item1 < item2, 0 if item1 == item2, +1 if item1 > item2
+	int compare(const QuantizedDrillingRecord& item1, const QuantizedDrillingRecord& item2) const;
+};
+
+#endif // !QUANTIZED_DRILLING_RECORD_COMPARATOR_H
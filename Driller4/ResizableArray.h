@@ -2,7 +2,13 @@
 #ifndef RESIZABLE_ARRAY_H
 #define RESIZABLE_ARRAY_H
 
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
 #include "Exceptions.h"
+#include "Enumerator.h"
+#include "ResizePolicy.h"
 
 const unsigned long DEFAULT_ARRAY_CAPACITY = 10;        // capacity used in no arg constructor
 
@@ -12,20 +18,44 @@ private:
 	unsigned long capacity = DEFAULT_ARRAY_CAPACITY;    // maximum capacity, in items
 	unsigned long size = 0;                             // actual number of items currently in array
 	T* data = NULL;                                     // pointer to array of any type
-	void doubleCapacity();                              // method to double array capacity
-	void halveCapacity();                               // method to halve array capacity
+	ResizePolicy policy;                                // decides when and how far the capacity grows or shrinks
+	void growCapacity();                                // method to grow a full array as the policy says
+	void shrinkCapacity();                              // method to shrink a sparse array as the policy says
+	void reallocate(unsigned long newCapacity);         // moves the items into a new array of newCapacity and frees the old one
 public:
 	ResizableArray();                                   // constructs array with default capacity
 	ResizableArray(unsigned long capacity);             // constructs array with specified capacity
+	ResizableArray(const ResizePolicy& policy);         // constructs array with default capacity that resizes as policy says
+	ResizableArray(const ResizableArray<T>& other);     // constructs a copy of other
+	ResizableArray(ResizableArray<T>&& other);          // takes over the items of other, leaving it empty
+	ResizableArray<T>& operator=(const ResizableArray<T>& other);   // replaces the items with a copy of other's
+	ResizableArray<T>& operator=(ResizableArray<T>&& other);        // takes over the items of other, leaving it empty
 	virtual ~ResizableArray();                          // frees array space as object is deleted
-	void add(T item);                                   // adds item, increments size, doubles capacity as necessary
-	void addAt(T item, unsigned long index);            // adds item at index, shifts following, doubles capacity as necessary
+	void add(const T& item);                            // adds item, increments size, grows capacity as necessary
+	void add(T&& item);                                 // moves item in, increments size, grows capacity as necessary
+	template <typename... Args>
+	void emplace(Args&&... args);                       // builds T(args...) and moves it into the next slot, grows capacity as necessary
+	void addAll(Enumerator<T>& enumerator);             // adds every item the enumerator has left, in order
+	template <typename Iterator>
+	void addAll(Iterator first, Iterator last);         // adds every item in [first, last), reserving room first when the length is known
+	void reserve(unsigned long minimumCapacity);        // grows capacity to at least minimumCapacity, items are unchanged
+	void addAt(T item, unsigned long index);            // adds item at index, shifts following, grows capacity as necessary
 	void replaceAt(T item, unsigned long index);        // replaces item at index, otherwise unchanged
 	void removeAt(unsigned long index);                 // removes item at index, shifts following back
 	T get(unsigned long index) const;                   // returns (copy of) item at index
+	const T& at(unsigned long index) const;             // returns reference to item at index, throws if out of range
+	T& at(unsigned long index);                         // returns modifiable reference to item at index, throws if out of range
+	const T& getUnchecked(unsigned long index) const;   // returns reference to item at index, index must be less than size
+	T& getUnchecked(unsigned long index);               // returns modifiable reference to item at index, index must be less than size
 	unsigned long getSize() const;                      // returns number of items currently in array
 	unsigned long getCapacity() const;                  // returns the current capacity of the array
-	T operator[](unsigned long index) const;            // returns (copy of) item at index
+	void setResizePolicy(const ResizePolicy& policy);   // changes how the array grows and shrinks from now on
+	const ResizePolicy& getResizePolicy() const;        // returns the policy in use
+	const T& operator[](unsigned long index) const;     // returns reference to item at index, throws if out of range
+	T* begin();                                         // pointer to the first item, the items are contiguous up to end()
+	T* end();                                           // pointer one past the last item
+	const T* begin() const;                             // read only pointer to the first item
+	const T* end() const;                               // read only pointer one past the last item
 	void clear();                                       // removes all items from array, resets to default capacity, set size to 0
 };
 
@@ -33,47 +63,39 @@ public:
 
 
 /*
-Method to double the array size if necessary
+Method to move every item into a new array of the given capacity and free the old one
 */
 template <typename T>
-void ResizableArray<T>::doubleCapacity() {
-	//doubles capacity for new array
-	unsigned long newCapacity = capacity * 2;
+void ResizableArray<T>::reallocate(unsigned long newCapacity) {
 
-	//creates a new drilling record array with updated size
+	//creates the new array and moves the items that fit into it
 	T* tempRecord = new T[newCapacity];
-
-	//copies data from old array to new one
-	for (unsigned long i = 0; i < capacity; i++) {
-		tempRecord[i] = data[i];
+	unsigned long itemsToMove = (size < newCapacity) ? size : newCapacity;
+	for (unsigned long i = 0; i < itemsToMove; i++) {
+		tempRecord[i] = std::move(data[i]);
 	}
 
-	//reassigns the pointer and clears the old array
+	//frees the old array and reassigns the pointer
+	delete[] data;
 	data = tempRecord;
 	tempRecord = nullptr;
 	capacity = newCapacity;
 }
 
 /*
-Method to halve the array size if necessary
+Method to grow the array once it is full
 */
 template <typename T>
-void ResizableArray<T>::halveCapacity() {
-	//doubles capacity for new array
-	unsigned long newCapacity = capacity / 2;
-
-	//creates a new drilling record array with updated size
-	T* tempRecord = new T[newCapacity];
-
-	//copies data from old array to new one
-	for (unsigned long i = 0; i < newCapacity; i++) {
-		tempRecord[i] = data[i];
-	}
+void ResizableArray<T>::growCapacity() {
+	reallocate(policy.grownCapacity(capacity));
+}
 
-	//reassigns the pointer and clears the old array
-	data = tempRecord;
-	tempRecord = nullptr;
-	capacity = newCapacity;
+/*
+Method to shrink the array once the policy finds it sparse enough
+*/
+template <typename T>
+void ResizableArray<T>::shrinkCapacity() {
+	reallocate(policy.shrunkCapacity(size, capacity));
 }
 
 /*
@@ -93,6 +115,70 @@ ResizableArray<T>::ResizableArray(unsigned long capacity) {
 	this->capacity = capacity;
 }
 
+/*
+Constructor that takes the policy used to grow and shrink the array
+*/
+template <typename T>
+ResizableArray<T>::ResizableArray(const ResizePolicy& policy) {
+	data = new T[DEFAULT_ARRAY_CAPACITY];
+	this->policy = policy;
+}
+
+/*
+Copy constructor, copies every item of the other array
+*/
+template <typename T>
+ResizableArray<T>::ResizableArray(const ResizableArray<T>& other) {
+	capacity = other.capacity;
+	size = other.size;
+	policy = other.policy;
+	data = new T[capacity];
+	for (unsigned long i = 0; i < size; i++) {
+		data[i] = other.data[i];
+	}
+}
+
+/*
+Move constructor, takes the other array's storage and leaves it empty
+*/
+template <typename T>
+ResizableArray<T>::ResizableArray(ResizableArray<T>&& other) {
+	capacity = other.capacity;
+	size = other.size;
+	data = other.data;
+	policy = other.policy;
+	other.data = new T[DEFAULT_ARRAY_CAPACITY];
+	other.capacity = DEFAULT_ARRAY_CAPACITY;
+	other.size = 0;
+}
+
+/*
+Copy assignment, replaces the items with copies of the other array's
+*/
+template <typename T>
+ResizableArray<T>& ResizableArray<T>::operator=(const ResizableArray<T>& other) {
+	if (this != &other) {
+		ResizableArray<T> copy(other);
+		*this = std::move(copy);
+	}
+	return *this;
+}
+
+/*
+Move assignment, swaps storage with the other array and leaves it empty
+*/
+template <typename T>
+ResizableArray<T>& ResizableArray<T>::operator=(ResizableArray<T>&& other) {
+	if (this != &other) {
+		std::swap(data, other.data);
+		std::swap(capacity, other.capacity);
+		std::swap(size, other.size);
+		std::swap(policy, other.policy);
+		other.clear();
+	}
+	return *this;
+}
+
 /*
 Destructor
 */
@@ -103,20 +189,91 @@ ResizableArray<T>::~ResizableArray() {
 }
 
 /*
-Method to add a new object to the array
+Method to add a copy of an object to the array
 */
 template <typename T>
-void ResizableArray<T>::add(T item) {
+void ResizableArray<T>::add(const T& item) {
 
-	//checks if size of array is greater than or equal to capacity and if so doubles the size of the array
+	//checks if size of array is greater than or equal to capacity and if so grows the array
 	if (size >= capacity) {
-		doubleCapacity();
+		growCapacity();
 	}
 
 	//adds item and increments size counter
 	data[size] = item;
 	size++;
+}
+
+/*
+Method to move an object into the array
+*/
+template <typename T>
+void ResizableArray<T>::add(T&& item) {
+
+	//checks if size of array is greater than or equal to capacity and if so grows the array
+	if (size >= capacity) {
+		growCapacity();
+	}
 
+	//moves item in and increments size counter
+	data[size] = std::move(item);
+	size++;
+}
+
+/*
+Method to build a new object from the given constructor arguments and move it to the end of the array
+The slots are default-constructed when the array grows, so T has to be default-constructible and
+move-assignable, the same as for add
+*/
+template <typename T>
+template <typename... Args>
+void ResizableArray<T>::emplace(Args&&... args) {
+
+	//checks if size of array is greater than or equal to capacity and if so grows the array
+	if (size >= capacity) {
+		growCapacity();
+	}
+
+	//move-assigns the new item over the empty slot and increments size counter
+	data[size] = T(std::forward<Args>(args)...);
+	size++;
+}
+
+/*
+Method to add every item remaining in an enumerator
+*/
+template <typename T>
+void ResizableArray<T>::addAll(Enumerator<T>& enumerator) {
+	while (enumerator.hasNext()) {
+		add(enumerator.next());
+	}
+}
+
+/*
+Method to add every item in a range, the array grows once up front when the range length is known
+*/
+template <typename T>
+template <typename Iterator>
+void ResizableArray<T>::addAll(Iterator first, Iterator last) {
+
+	//forward iterators can be measured without being used up
+	if constexpr (std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value) {
+		reserve(size + (unsigned long)std::distance(first, last));
+	}
+
+	for (; first != last; ++first) {
+		add(*first);
+	}
+}
+
+/*
+Method to make room for at least the given number of items
+*/
+template <typename T>
+void ResizableArray<T>::reserve(unsigned long minimumCapacity) {
+	if (minimumCapacity > capacity) {
+		reallocate(minimumCapacity);
+	}
 }
 
 /*
@@ -125,20 +282,20 @@ Method to add object at specified index of array
 template <typename T>
 void ResizableArray<T>::addAt(T item, unsigned long index) {
 
-	//checks if array capacity needs to be doubled
+	//checks if array capacity needs to grow
 	if (size >= capacity) {
-		doubleCapacity();
+		growCapacity();
 	}
 
 	//makes sure the given index is within the size of the array and throws and error otherwise
 	if (index < size) {
 		//shifts data to fit in new item at specified location
-		for (unsigned long i = size; i >= index; i--) {
-			data[i] = data[i - 1];
+		for (unsigned long i = size; i > index; i--) {
+			data[i] = std::move(data[i - 1]);
 		}
 
 		//adds item at given index
-		data[index] = item;
+		data[index] = std::move(item);
 		size++;
 	}
 	else {
@@ -155,7 +312,7 @@ void ResizableArray<T>::replaceAt(T item, unsigned long index) {
 
 	//makes sure index is within size of array and throws exception otherwise
 	if (index < size) {
-		data[index] = item;
+		data[index] = std::move(item);
 	}
 	else {
 		throw new ExceptionIndexOutOfRange();
@@ -168,16 +325,11 @@ Method to remove object at given index
 template <typename T>
 void ResizableArray<T>::removeAt(unsigned long index) {
 
-	//checks if array capacity needs to be halved
-	if (size <= capacity / 2) {
-		halveCapacity();
-	}
-
 	//makes sure index is within size of array and throws an exception otherwise
 	if (index < size) {
-		//shifts data to fit in new item at specified location
-		for (unsigned long i = index; i < size; i++) {
-			data[i] = data[i + 1];
+		//shifts the following data back over the removed item
+		for (unsigned long i = index; i + 1 < size; i++) {
+			data[i] = std::move(data[i + 1]);
 		}
 
 		size--;
@@ -186,6 +338,10 @@ void ResizableArray<T>::removeAt(unsigned long index) {
 		throw new ExceptionIndexOutOfRange();
 	}
 
+	//checks if array capacity should shrink now that the item is gone
+	if (policy.shouldShrink(size, capacity)) {
+		shrinkCapacity();
+	}
 }
 
 /*
@@ -206,6 +362,52 @@ T ResizableArray<T>::get(unsigned long index) const {
 	}
 }
 
+/*
+Method to get a reference to the data at given index
+*/
+template <typename T>
+const T& ResizableArray<T>::at(unsigned long index) const {
+
+	//checks if index is within array size and throws an exception if not
+	if (index < size) {
+		return data[index];
+	}
+	else {
+		throw new ExceptionIndexOutOfRange();
+	}
+}
+
+/*
+Method to get a modifiable reference to the data at given index
+*/
+template <typename T>
+T& ResizableArray<T>::at(unsigned long index) {
+
+	//checks if index is within array size and throws an exception if not
+	if (index < size) {
+		return data[index];
+	}
+	else {
+		throw new ExceptionIndexOutOfRange();
+	}
+}
+
+/*
+Method to get a reference to the data at given index without checking the index
+*/
+template <typename T>
+const T& ResizableArray<T>::getUnchecked(unsigned long index) const {
+	return data[index];
+}
+
+/*
+Method to get a modifiable reference to the data at given index without checking the index
+*/
+template <typename T>
+T& ResizableArray<T>::getUnchecked(unsigned long index) {
+	return data[index];
+}
+
 /*
 Method to get the current size of the array
 */
@@ -222,21 +424,52 @@ unsigned long ResizableArray<T>::getCapacity() const {
 	return capacity;
 }
 
+/*
+Method to change the policy used to grow and shrink the array
+*/
+template <typename T>
+void ResizableArray<T>::setResizePolicy(const ResizePolicy& policy) {
+	this->policy = policy;
+}
+
+/*
+Method to get the policy used to grow and shrink the array
+*/
+template <typename T>
+const ResizePolicy& ResizableArray<T>::getResizePolicy() const {
+	return policy;
+}
+
 /*
 Overloads the [] operator to return the value at the given index
 */
 template <typename T>
-T ResizableArray<T>::operator[](unsigned long index) const {
-	if (index < size) {
-		if (index < 0) {
-			std::cout << "Index is " << index << std::endl;
-		}
-		return data[index];
-	}
-	else {
-		throw new ExceptionIndexOutOfRange();
-	}
+const T& ResizableArray<T>::operator[](unsigned long index) const {
+	return at(index);
+}
 
+/*
+Methods to get the bounds of the stored items so they can be walked with a pointer
+or a range based for loop, the pointers are invalidated by anything that changes the capacity
+*/
+template <typename T>
+T* ResizableArray<T>::begin() {
+	return data;
+}
+
+template <typename T>
+T* ResizableArray<T>::end() {
+	return data + size;
+}
+
+template <typename T>
+const T* ResizableArray<T>::begin() const {
+	return data;
+}
+
+template <typename T>
+const T* ResizableArray<T>::end() const {
+	return data + size;
 }
 
 /*
@@ -0,0 +1,79 @@
+#include "ResizePolicy.h"
+
+/*
+Default constructor, doubles when full and halves at 25% occupancy
+*/
+ResizePolicy::ResizePolicy() {
+}
+
+/*
+Constructor that takes the grow and shrink thresholds
+*/
+ResizePolicy::ResizePolicy(float growFactor, float shrinkLoad, float shrinkFactor, unsigned long minimumCapacity) {
+	this->growFactor = growFactor;
+	this->shrinkLoad = shrinkLoad;
+	this->shrinkFactor = shrinkFactor;
+	this->minimumCapacity = minimumCapacity;
+}
+
+/*
+Method to make a policy that never gives capacity back
+*/
+ResizePolicy ResizePolicy::neverShrink() {
+	ResizePolicy policy;
+	policy.shrinkEnabled = false;
+	return policy;
+}
+
+/*
+Method to calculate the capacity a full array should grow to
+*/
+unsigned long ResizePolicy::grownCapacity(unsigned long capacity) const {
+
+	//an array with no room starts over from the minimum capacity
+	if (capacity == 0) {
+		return (minimumCapacity > 0) ? minimumCapacity : 1;
+	}
+
+	//always grows by at least one item whatever the factor is
+	unsigned long newCapacity = (unsigned long)((double)capacity * growFactor);
+	if (newCapacity <= capacity) {
+		newCapacity = capacity + 1;
+	}
+	return newCapacity;
+}
+
+/*
+Method to check whether the array is sparse enough to shrink
+*/
+bool ResizePolicy::shouldShrink(unsigned long size, unsigned long capacity) const {
+
+	//never shrinks when disabled or when already at the minimum
+	if (!shrinkEnabled || capacity <= minimumCapacity) {
+		return false;
+	}
+	return (double)size <= (double)capacity * shrinkLoad;
+}
+
+/*
+Method to calculate the capacity a sparse array should shrink to
+*/
+unsigned long ResizePolicy::shrunkCapacity(unsigned long size, unsigned long capacity) const {
+
+	//keeps room for every item and never goes below the minimum
+	unsigned long newCapacity = (unsigned long)((double)capacity * shrinkFactor);
+	if (newCapacity < size) {
+		newCapacity = size;
+	}
+	if (newCapacity < minimumCapacity) {
+		newCapacity = minimumCapacity;
+	}
+	return newCapacity;
+}
+
+/*
+Method to check whether the policy ever shrinks
+*/
+bool ResizePolicy::isShrinkEnabled() const {
+	return shrinkEnabled;
+}
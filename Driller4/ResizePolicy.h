@@ -0,0 +1,31 @@
+#pragma once
+#ifndef RESIZE_POLICY_H
+#define RESIZE_POLICY_H
+
+// ResizePolicy decides when a ResizableArray grows or shrinks and by how much.
+// Growing happens when the array is full and shrinking only once occupancy falls to
+// shrinkLoad, so an array that has just grown has to lose most of its items before it
+// shrinks again and alternating adds and removes don't reallocate on every call
+class ResizePolicy {
+private:
+	float growFactor = 2.0f;                           // capacity is multiplied by this when the array is full
+	float shrinkLoad = 0.25f;                          // capacity shrinks once size / capacity is at or below this
+	float shrinkFactor = 0.5f;                         // capacity is multiplied by this when shrinking
+	unsigned long minimumCapacity = 10;                // capacity never shrinks below this, matches DEFAULT_ARRAY_CAPACITY
+	bool shrinkEnabled = true;                         // false keeps the capacity at its high water mark
+public:
+	ResizePolicy();                                    // doubles when full, halves at 25% occupancy
+
+	// shrinkLoad should stay below shrinkFactor so a shrunk array is not immediately due to shrink again,
+	// the computed capacities always grow by at least one item and never shrink below the current size
+	ResizePolicy(float growFactor, float shrinkLoad, float shrinkFactor, unsigned long minimumCapacity);
+
+	static ResizePolicy neverShrink();                 // doubles when full and never gives capacity back
+
+	unsigned long grownCapacity(unsigned long capacity) const;                      // capacity to use once the array is full
+	bool shouldShrink(unsigned long size, unsigned long capacity) const;             // true if the array is sparse enough to shrink
+	unsigned long shrunkCapacity(unsigned long size, unsigned long capacity) const;  // capacity to use when shrinking, always at least size
+	bool isShrinkEnabled() const;                      // returns false for the never shrink mode
+};
+
+#endif // !RESIZE_POLICY_H
@@ -6,66 +6,100 @@
 
 #include "Exceptions.h"
 #include "ResizableArray.h"
+#include "SegmentedArray.h"
 #include "Comparator.h"
 
-// returns FIRST array location matching the given item (based on the comparator)
-// if not found, returns -(location to insert + 1)
-template <typename T>
-long long static binarySearch(const T& item, const ResizableArray<T>& array, const Comparator<T>& comparator) {
+// positions [first, last) of an array, as returned by equalRange and rangeSearch
+struct SearchRange {
+	unsigned long first;                                       // position of the first item in the range
+	unsigned long last;                                        // position just past the last item in the range
+	unsigned long getCount() const {                           // returns the number of items in the range
+		return (last > first) ? last - first : 0;
+	}
+};
 
-	//declares the low, mid, and high of the array to search
-	long long mid = 0;
-	long long low = 0;
-	long long high = array.getSize() - 1L;
-
-	//loops for as long as high is greater than low
-	while (high >= low) {
-		//gets the midpoint of the array to search
-		mid = (high + low) / 2;
-		//compares the midpoint and the item to find
-		int index = 0;
-		//compares the two items and catches an index out of bounds exception
-		try {
-			index = comparator.compare(array[mid], item);
+// lower bound over any array with getSize and getUnchecked, see lowerBound
+template <typename T, typename Array, typename Compare>
+unsigned long static lowerBoundArray(const T& item, const Array& array, const Compare& comparator) {
+
+	//the answer is always in [low, high], every item before low is less than item
+	unsigned long low = 0;
+	unsigned long high = array.getSize();
+	while (low < high) {
+		unsigned long mid = low + (high - low) / 2;
+		if (comparator.compare(array.getUnchecked(mid), item) < 0) {
+			low = mid + 1;
 		}
-		catch (ExceptionIndexOutOfRange* e) {
-			delete e;
+		else {
+			high = mid;
 		}
+	}
+	return low;
+}
 
-		//checks whether the item is above or below the midpoint
-		if (index < 0L) {
-			low = mid + 1L;
-		}
-		else if (index > 0L) {
-			high = mid - 1L;
+// upper bound over any array with getSize and getUnchecked, see upperBound
+template <typename T, typename Array, typename Compare>
+unsigned long static upperBoundArray(const T& item, const Array& array, const Compare& comparator) {
+
+	//the answer is always in [low, high], every item before low is not greater than item
+	unsigned long low = 0;
+	unsigned long high = array.getSize();
+	while (low < high) {
+		unsigned long mid = low + (high - low) / 2;
+		if (comparator.compare(array.getUnchecked(mid), item) <= 0) {
+			low = mid + 1;
 		}
-		//if location equals midpoint loops through to find the first location of it in the array and returns that location
 		else {
-			long long location = mid;
+			high = mid;
+		}
+	}
+	return low;
+}
 
-			if (location > 0L) {
+// equal range over any array with getSize and getUnchecked, see equalRange
+template <typename T, typename Array, typename Compare>
+SearchRange static equalRangeArray(const T& item, const Array& array, const Compare& comparator) {
+	SearchRange range;
+	range.first = lowerBoundArray(item, array, comparator);
+	range.last = upperBoundArray(item, array, comparator);
+	return range;
+}
 
-				//finds first location of item in the array
-				while (location - 1 >= 0 && comparator.compare(array[(unsigned long) location - 1], array[(unsigned long) location]) == 0) {
-					location = location - 1L;
-				}
-				return location;
-			}
-		}
+// range search over any array with getSize and getUnchecked, see rangeSearch
+template <typename T, typename Array, typename Compare>
+SearchRange static rangeSearchArray(const T& low, const T& high, const Array& array, const Compare& comparator) {
+	SearchRange range;
+	range.first = lowerBoundArray(low, array, comparator);
+	range.last = upperBoundArray(high, array, comparator);
+
+	//a low above high gives an empty range
+	if (range.last < range.first) {
+		range.last = range.first;
 	}
+	return range;
+}
+
+// binary search over any array with getSize and getUnchecked, see binarySearch
+template <typename T, typename Array, typename Compare>
+long long static binarySearchArray(const T& item, const Array& array, const Compare& comparator) {
+
+	//the first item not less than the given one is the first match if there is one
+	unsigned long location = lowerBoundArray(item, array, comparator);
+	if (location < array.getSize() && comparator.compare(array.getUnchecked(location), item) == 0) {
+		return (long long)location;
+	}
+
 	//if not found returns the negative location to be inserted
-	return -(mid + 1);
+	return -((long long)location + 1);
 }
 
-/*
-Linear search method to find the first instance of the given item in the array
-*/
-template <typename T>
-long long static linearSearch(const T& item, const ResizableArray<T>& array, const Comparator<T>& comparator) {
+// linear search over any array with getSize and getUnchecked, see linearSearch
+template <typename T, typename Array, typename Compare>
+long long static linearSearchArray(const T& item, const Array& array, const Compare& comparator) {
 
 	//loops through the array to find the given item
 	for (unsigned int i = 0; i < array.getSize(); i++) {
-		if (comparator.compare(array[i], item) == 0) {
+		if (comparator.compare(array.getUnchecked(i), item) == 0) {
 			return (long long)i;
 		}
 	}
@@ -73,5 +107,96 @@ long long static linearSearch(const T& item, const ResizableArray<T>& array, con
 	return -1;
 }
 
+// returns FIRST array location matching the given item (based on the comparator)
+// if not found, returns -(location to insert + 1)
+template <typename T>
+long long static binarySearch(const T& item, const ResizableArray<T>& array, const Comparator<T>& comparator) {
+	return binarySearchArray(item, array, comparator);
+}
+
+template <typename T>
+long long static binarySearch(const T& item, const SegmentedArray<T>& array, const Comparator<T>& comparator) {
+	return binarySearchArray(item, array, comparator);
+}
+
+// the same searches for a comparator whose type is known at compile time, such as a DrillingRecordColumnComparator,
+// compare is then called without virtual dispatch and can be inlined into the search loop
+template <typename T, typename Compare>
+long long static binarySearch(const T& item, const ResizableArray<T>& array, const Compare& comparator) {
+	return binarySearchArray(item, array, comparator);
+}
+
+template <typename T, typename Compare>
+long long static binarySearch(const T& item, const SegmentedArray<T>& array, const Compare& comparator) {
+	return binarySearchArray(item, array, comparator);
+}
+
+/*
+Linear search method to find the first instance of the given item in the array
+*/
+template <typename T>
+long long static linearSearch(const T& item, const ResizableArray<T>& array, const Comparator<T>& comparator) {
+	return linearSearchArray(item, array, comparator);
+}
+
+template <typename T>
+long long static linearSearch(const T& item, const SegmentedArray<T>& array, const Comparator<T>& comparator) {
+	return linearSearchArray(item, array, comparator);
+}
+
+template <typename T, typename Compare>
+long long static linearSearch(const T& item, const ResizableArray<T>& array, const Compare& comparator) {
+	return linearSearchArray(item, array, comparator);
+}
+
+template <typename T, typename Compare>
+long long static linearSearch(const T& item, const SegmentedArray<T>& array, const Compare& comparator) {
+	return linearSearchArray(item, array, comparator);
+}
+
+// the array must be sorted by the comparator for the searches below
+// returns the position of the first item not less than the given item, the size of the array if there is none
+template <typename T, typename Compare>
+unsigned long static lowerBound(const T& item, const ResizableArray<T>& array, const Compare& comparator) {
+	return lowerBoundArray(item, array, comparator);
+}
+
+template <typename T, typename Compare>
+unsigned long static lowerBound(const T& item, const SegmentedArray<T>& array, const Compare& comparator) {
+	return lowerBoundArray(item, array, comparator);
+}
+
+// returns the position of the first item greater than the given item, the size of the array if there is none
+template <typename T, typename Compare>
+unsigned long static upperBound(const T& item, const ResizableArray<T>& array, const Compare& comparator) {
+	return upperBoundArray(item, array, comparator);
+}
+
+template <typename T, typename Compare>
+unsigned long static upperBound(const T& item, const SegmentedArray<T>& array, const Compare& comparator) {
+	return upperBoundArray(item, array, comparator);
+}
+
+// returns the positions of every item equal to the given item, an empty range at the insert position if there are none
+template <typename T, typename Compare>
+SearchRange static equalRange(const T& item, const ResizableArray<T>& array, const Compare& comparator) {
+	return equalRangeArray(item, array, comparator);
+}
+
+template <typename T, typename Compare>
+SearchRange static equalRange(const T& item, const SegmentedArray<T>& array, const Compare& comparator) {
+	return equalRangeArray(item, array, comparator);
+}
+
+// returns the positions of every item from low to high inclusive, the count takes two searches and no scan
+template <typename T, typename Compare>
+SearchRange static rangeSearch(const T& low, const T& high, const ResizableArray<T>& array, const Compare& comparator) {
+	return rangeSearchArray(low, high, array, comparator);
+}
+
+template <typename T, typename Compare>
+SearchRange static rangeSearch(const T& low, const T& high, const SegmentedArray<T>& array, const Compare& comparator) {
+	return rangeSearchArray(low, high, array, comparator);
+}
 
 #endif
\ No newline at end of file
@@ -0,0 +1,401 @@
+#pragma once
+#ifndef SEGMENTED_ARRAY_H
+#define SEGMENTED_ARRAY_H
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "Exceptions.h"
+#include "Enumerator.h"
+#include "ResizableArray.h"
+
+const unsigned long SEGMENT_SHIFT = 10;                        // log2 of the number of items in each segment
+const unsigned long SEGMENT_ITEMS = 1UL << SEGMENT_SHIFT;      // number of items in each segment
+const unsigned long SEGMENT_MASK = SEGMENT_ITEMS - 1;          // picks the position inside a segment out of an index
+
+// SegmentedArray offers the same indexed interface as ResizableArray but stores its items in
+// fixed size segments. Growing only appends a segment, so items already stored never move and
+// references to them stay valid until they are removed or shifted by addAt/removeAt
+template <typename T>
+class SegmentedArray {
+private:
+	ResizableArray<T*> segments;                               // pointers to the segments, in index order
+	unsigned long size = 0;                                    // actual number of items currently in array
+	void addSegment();                                         // appends an empty segment
+	void releaseSpareSegments();                               // frees the segments no item needs, keeping one spare
+	T& slot(unsigned long index) const;                        // the storage for index, which must be below the capacity
+public:
+	SegmentedArray();                                          // constructs an empty array, no segment is allocated yet
+	SegmentedArray(const SegmentedArray<T>& other);            // constructs a copy of other
+	SegmentedArray(SegmentedArray<T>&& other);                 // takes over the segments of other, leaving it empty
+	SegmentedArray<T>& operator=(const SegmentedArray<T>& other);   // replaces the items with a copy of other's
+	SegmentedArray<T>& operator=(SegmentedArray<T>&& other);        // takes over the segments of other, leaving it empty
+	virtual ~SegmentedArray();                                 // frees every segment as object is deleted
+	void add(const T& item);                                   // adds item, appends a segment as necessary
+	void add(T&& item);                                        // moves item in, appends a segment as necessary
+	template <typename... Args>
+	void emplace(Args&&... args);                              // builds T(args...) and moves it into the next slot
+	void addAll(Enumerator<T>& enumerator);                    // adds every item the enumerator has left, in order
+	template <typename Iterator>
+	void addAll(Iterator first, Iterator last);                // adds every item in [first, last)
+	void reserve(unsigned long minimumCapacity);               // allocates segments until at least minimumCapacity items fit
+	void addAt(T item, unsigned long index);                   // adds item at index, shifts following
+	void replaceAt(T item, unsigned long index);               // replaces item at index, otherwise unchanged
+	void removeAt(unsigned long index);                        // removes item at index, shifts following back
+	T get(unsigned long index) const;                          // returns (copy of) item at index
+	const T& at(unsigned long index) const;                    // returns reference to item at index, throws if out of range
+	T& at(unsigned long index);                                // returns modifiable reference to item at index, throws if out of range
+	const T& getUnchecked(unsigned long index) const;          // returns reference to item at index, index must be less than size
+	T& getUnchecked(unsigned long index);                      // returns modifiable reference to item at index, index must be less than size
+	unsigned long getSize() const;                             // returns number of items currently in array
+	unsigned long getCapacity() const;                         // returns the number of items the allocated segments hold
+	const T& operator[](unsigned long index) const;            // returns reference to item at index, throws if out of range
+	void clear();                                              // removes all items and frees every segment
+};
+
+/*
+Method to append an empty segment
+*/
+template <typename T>
+void SegmentedArray<T>::addSegment() {
+	segments.add(new T[SEGMENT_ITEMS]);
+}
+
+/*
+Method to free the segments at the end that hold no items, one empty segment is kept
+so removing and adding around a segment boundary doesn't allocate every time
+*/
+template <typename T>
+void SegmentedArray<T>::releaseSpareSegments() {
+
+	//number of segments the items need plus the spare
+	unsigned long needed = ((size + SEGMENT_MASK) >> SEGMENT_SHIFT) + 1;
+	while (segments.getSize() > needed) {
+		delete[] segments.getUnchecked(segments.getSize() - 1);
+		segments.removeAt(segments.getSize() - 1);
+	}
+}
+
+/*
+Method to find the storage for an index
+*/
+template <typename T>
+T& SegmentedArray<T>::slot(unsigned long index) const {
+	return segments.getUnchecked(index >> SEGMENT_SHIFT)[index & SEGMENT_MASK];
+}
+
+/*
+Default constructor
+*/
+template <typename T>
+SegmentedArray<T>::SegmentedArray() {
+}
+
+/*
+Copy constructor, copies every item of the other array
+*/
+template <typename T>
+SegmentedArray<T>::SegmentedArray(const SegmentedArray<T>& other) {
+	reserve(other.size);
+	for (unsigned long i = 0; i < other.size; i++) {
+		slot(i) = other.slot(i);
+	}
+	size = other.size;
+}
+
+/*
+Move constructor, takes the other array's segments and leaves it empty
+*/
+template <typename T>
+SegmentedArray<T>::SegmentedArray(SegmentedArray<T>&& other) {
+	segments = std::move(other.segments);
+	size = other.size;
+	other.size = 0;
+}
+
+/*
+Copy assignment, replaces the items with copies of the other array's
+*/
+template <typename T>
+SegmentedArray<T>& SegmentedArray<T>::operator=(const SegmentedArray<T>& other) {
+	if (this != &other) {
+		SegmentedArray<T> copy(other);
+		*this = std::move(copy);
+	}
+	return *this;
+}
+
+/*
+Move assignment, frees this array's segments and takes the other array's
+*/
+template <typename T>
+SegmentedArray<T>& SegmentedArray<T>::operator=(SegmentedArray<T>&& other) {
+	if (this != &other) {
+		clear();
+		segments = std::move(other.segments);
+		size = other.size;
+		other.size = 0;
+	}
+	return *this;
+}
+
+/*
+Destructor
+*/
+template <typename T>
+SegmentedArray<T>::~SegmentedArray() {
+	clear();
+}
+
+/*
+Method to add a copy of an object to the array
+*/
+template <typename T>
+void SegmentedArray<T>::add(const T& item) {
+
+	//appends a segment if every existing one is full
+	if (size >= getCapacity()) {
+		addSegment();
+	}
+
+	//adds item and increments size counter
+	slot(size) = item;
+	size++;
+}
+
+/*
+Method to move an object into the array
+*/
+template <typename T>
+void SegmentedArray<T>::add(T&& item) {
+
+	//appends a segment if every existing one is full
+	if (size >= getCapacity()) {
+		addSegment();
+	}
+
+	//moves item in and increments size counter
+	slot(size) = std::move(item);
+	size++;
+}
+
+/*
+Method to build a new object from the given constructor arguments and move it to the end of the array
+The slots are default-constructed when the array grows, so T has to be default-constructible and
+move-assignable, the same as for add
+*/
+template <typename T>
+template <typename... Args>
+void SegmentedArray<T>::emplace(Args&&... args) {
+
+	//appends a segment if every existing one is full
+	if (size >= getCapacity()) {
+		addSegment();
+	}
+
+	//move-assigns the new item over the empty slot and increments size counter
+	slot(size) = T(std::forward<Args>(args)...);
+	size++;
+}
+
+/*
+Method to add every item remaining in an enumerator
+*/
+template <typename T>
+void SegmentedArray<T>::addAll(Enumerator<T>& enumerator) {
+	while (enumerator.hasNext()) {
+		add(enumerator.next());
+	}
+}
+
+/*
+Method to add every item in a range, the segments are allocated up front when the range length is known
+*/
+template <typename T>
+template <typename Iterator>
+void SegmentedArray<T>::addAll(Iterator first, Iterator last) {
+
+	//forward iterators can be measured without being used up
+	if constexpr (std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value) {
+		reserve(size + (unsigned long)std::distance(first, last));
+	}
+
+	for (; first != last; ++first) {
+		add(*first);
+	}
+}
+
+/*
+Method to allocate segments until the given number of items fit
+*/
+template <typename T>
+void SegmentedArray<T>::reserve(unsigned long minimumCapacity) {
+
+	//grows the segment list once, then fills it
+	segments.reserve((minimumCapacity + SEGMENT_MASK) >> SEGMENT_SHIFT);
+	while (getCapacity() < minimumCapacity) {
+		addSegment();
+	}
+}
+
+/*
+Method to add object at specified index of array
+*/
+template <typename T>
+void SegmentedArray<T>::addAt(T item, unsigned long index) {
+
+	//makes sure the given index is within the size of the array and throws and error otherwise
+	if (index < size) {
+
+		//appends a segment if every existing one is full
+		if (size >= getCapacity()) {
+			addSegment();
+		}
+
+		//shifts data to fit in new item at specified location
+		for (unsigned long i = size; i > index; i--) {
+			slot(i) = std::move(slot(i - 1));
+		}
+
+		//adds item at given index
+		slot(index) = std::move(item);
+		size++;
+	}
+	else {
+		throw new ExceptionIndexOutOfRange();
+	}
+}
+
+/*
+Method to replace item at given index with new item
+*/
+template <typename T>
+void SegmentedArray<T>::replaceAt(T item, unsigned long index) {
+
+	//makes sure index is within size of array and throws exception otherwise
+	if (index < size) {
+		slot(index) = std::move(item);
+	}
+	else {
+		throw new ExceptionIndexOutOfRange();
+	}
+}
+
+/*
+Method to remove object at given index
+*/
+template <typename T>
+void SegmentedArray<T>::removeAt(unsigned long index) {
+
+	//makes sure index is within size of array and throws an exception otherwise
+	if (index < size) {
+
+		//shifts the following data back over the removed item
+		for (unsigned long i = index; i + 1 < size; i++) {
+			slot(i) = std::move(slot(i + 1));
+		}
+
+		//resets the freed slot so it lets go of anything it owns
+		slot(size - 1) = T();
+		size--;
+	}
+	else {
+		throw new ExceptionIndexOutOfRange();
+	}
+
+	releaseSpareSegments();
+}
+
+/*
+Method to get copy of data at given index
+*/
+template <typename T>
+T SegmentedArray<T>::get(unsigned long index) const {
+	return at(index);
+}
+
+/*
+Method to get a reference to the data at given index
+*/
+template <typename T>
+const T& SegmentedArray<T>::at(unsigned long index) const {
+
+	//checks if index is within array size and throws an exception if not
+	if (index < size) {
+		return slot(index);
+	}
+	else {
+		throw new ExceptionIndexOutOfRange();
+	}
+}
+
+/*
+Method to get a modifiable reference to the data at given index
+*/
+template <typename T>
+T& SegmentedArray<T>::at(unsigned long index) {
+
+	//checks if index is within array size and throws an exception if not
+	if (index < size) {
+		return slot(index);
+	}
+	else {
+		throw new ExceptionIndexOutOfRange();
+	}
+}
+
+/*
+Method to get a reference to the data at given index without checking the index
+*/
+template <typename T>
+const T& SegmentedArray<T>::getUnchecked(unsigned long index) const {
+	return slot(index);
+}
+
+/*
+Method to get a modifiable reference to the data at given index without checking the index
+*/
+template <typename T>
+T& SegmentedArray<T>::getUnchecked(unsigned long index) {
+	return slot(index);
+}
+
+/*
+Method to get the current size of the array
+*/
+template <typename T>
+unsigned long SegmentedArray<T>::getSize() const {
+	return size;
+}
+
+/*
+Method to get the number of items the allocated segments can hold
+*/
+template <typename T>
+unsigned long SegmentedArray<T>::getCapacity() const {
+	return segments.getSize() << SEGMENT_SHIFT;
+}
+
+/*
+Overloads the [] operator to return the value at the given index
+*/
+template <typename T>
+const T& SegmentedArray<T>::operator[](unsigned long index) const {
+	return at(index);
+}
+
+/*
+Method to clear the array
+*/
+template <typename T>
+void SegmentedArray<T>::clear() {
+
+	//frees every segment, then the list of them
+	for (unsigned long i = 0; i < segments.getSize(); i++) {
+		delete[] segments.getUnchecked(i);
+	}
+	segments.clear();
+	size = 0;
+}
+
+#endif // !SEGMENTED_ARRAY_H
@@ -0,0 +1,16 @@
+#pragma once
+#ifndef SORT_KEY_EXTRACTOR_H
+#define SORT_KEY_EXTRACTOR_H
+
+// SortKeyExtractor is implemented by comparators whose order can also be written as one unsigned
+// 64 bit key per item. Sorter checks for it and radix sorts the keys instead of calling compare
+template <typename T>
+class SortKeyExtractor {
+public:
+	// sets key so that keys order items the same way compare does and equal keys mean compare returns 0,
+	// returns false if the item has no such key, in which case the comparison sort is used
+	virtual bool getSortKey(const T& item, unsigned long long& key) const = 0;
+	virtual ~SortKeyExtractor() = default;
+};
+
+#endif // !SORT_KEY_EXTRACTOR_H
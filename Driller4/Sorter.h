@@ -4,19 +4,120 @@
 #ifndef SORT_H
 #define SORT_H
 
+#include <algorithm>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "Exceptions.h"
 #include "ResizableArray.h"
+#include "SegmentedArray.h"
 #include "Comparator.h"
+#include "SortKeyExtractor.h"
 #include "DrillingRecord.h"
 
+const unsigned long INSERTION_SORT_ITEMS = 16;         // ranges this small are finished with insertion sort
+const unsigned long NINTHER_ITEMS = 128;               // ranges at least this large take the pivot from nine items instead of three
+const unsigned long PARALLEL_SORT_ITEMS = 16384;       // ranges smaller than this are not worth handing to another thread
+const unsigned long KEYED_SORT_ITEMS = 256;            // arrays smaller than this are sorted in place even when keys exist
+
+// how Sorter orders items whose comparator can also give each item a key (see SortKeyExtractor)
+enum class SortMode {
+	inPlace,                                           // comparison sort that moves the items themselves
+	decorated,                                         // comparison sort of (key, index) pairs, then each item is moved once
+	radix                                              // radix sort of (key, index) pairs, then each item is moved once
+};
+
+// the compact stand-in for an item that the decorated and radix modes sort
+struct SortKey {
+	unsigned long long key;                            // sort key of the item
+	unsigned long index;                               // where the item was before sorting
+};
+
+// orders sort keys by key, ties keep their index order so both keyed modes give the same stable result
+struct SortKeyOrder {
+	int compare(const SortKey& key1, const SortKey& key2) const {
+		if (key1.key != key2.key) {
+			return (key1.key < key2.key) ? -1 : 1;
+		}
+		return (key1.index < key2.index) ? -1 : ((key1.index > key2.index) ? 1 : 0);
+	}
+};
+
 template <typename T>
 class Sorter {
+	template <typename U>
+	friend class Sorter;
 private:
 	// additional member functions (methods) and variables (fields) may be added
-	static void quickSort(ResizableArray<T>& array, unsigned long left, unsigned long right, const Comparator<T>& comparator);
-	static unsigned long partition(ResizableArray<T>& array, unsigned long left, unsigned long right, const Comparator<T>& comparator);
+	template <typename Array, typename Compare>
+	struct IndexOrder {
+		const Array& array;                            // the array the positions refer to
+		const Compare& comparator;                     // orders the items at two positions
+		int compare(unsigned long index1, unsigned long index2) const;
+	};
+	template <typename Array, typename Compare>
+	static bool keyedSort(Array& array, const Compare& comparator, unsigned int threadCount, SortMode mode);
+	template <typename Array, typename Compare>
+	static void orderArray(const Array& array, const Compare& comparator, unsigned int threadCount, ResizableArray<unsigned long>& order);
+	template <typename Array, typename Compare>
+	static bool getKeys(const Array& array, const Compare& comparator, ResizableArray<SortKey>& keys);
+	template <typename Array, typename Extractor>
+	static bool extractKeys(const Array& array, const Extractor& extractor, ResizableArray<SortKey>& keys);
+	static void radixSortKeys(ResizableArray<SortKey>& keys);
+	template <typename Array>
+	static void applyOrder(Array& array, ResizableArray<SortKey>& keys);
+	template <typename Array, typename Compare>
+	static void sortArray(Array& array, const Compare& comparator, unsigned int threadCount, SortMode mode);
+	template <typename Array, typename Compare>
+	static void introSort(Array& array, unsigned long first, unsigned long last, unsigned int depthLimit, const Compare& comparator);
+	template <typename Array, typename Compare>
+	static void parallelIntroSort(Array& array, unsigned long first, unsigned long last, unsigned int depthLimit, unsigned int threadCount, const Compare& comparator);
+	template <typename Array, typename Compare>
+	static void sortThree(Array& array, unsigned long a, unsigned long b, unsigned long c, const Compare& comparator);
+	template <typename Array, typename Compare>
+	static void choosePivot(Array& array, unsigned long first, unsigned long last, const Compare& comparator);
+	template <typename Array, typename Compare>
+	static unsigned long partition(Array& array, unsigned long first, unsigned long last, const Compare& comparator);
+	template <typename Array, typename Compare>
+	static void insertionSort(Array& array, unsigned long first, unsigned long last, const Compare& comparator);
+	template <typename Array, typename Compare>
+	static void siftDown(Array& array, unsigned long first, unsigned long root, unsigned long count, const Compare& comparator);
+	template <typename Array, typename Compare>
+	static void heapSort(Array& array, unsigned long first, unsigned long last, const Compare& comparator);
 public:
 	static void sort(ResizableArray<T>& array, const Comparator<T>& comparator);
+	static void sort(SegmentedArray<T>& array, const Comparator<T>& comparator);
+
+	// sorts on up to threadCount threads, 0 uses every hardware thread and 1 sorts on the calling thread
+	// the result is the same as sort() for any thread count, comparator.compare must be safe to call from several threads
+	static void sort(ResizableArray<T>& array, const Comparator<T>& comparator, unsigned int threadCount);
+	static void sort(SegmentedArray<T>& array, const Comparator<T>& comparator, unsigned int threadCount);
+
+	// the same sorts for a comparator whose type is known at compile time, such as a DrillingRecordColumnComparator,
+	// compare is then called without virtual dispatch and can be inlined into the sorting loops
+	template <typename Compare>
+	static void sort(ResizableArray<T>& array, const Compare& comparator);
+	template <typename Compare>
+	static void sort(SegmentedArray<T>& array, const Compare& comparator);
+	template <typename Compare>
+	static void sort(ResizableArray<T>& array, const Compare& comparator, unsigned int threadCount);
+	template <typename Compare>
+	static void sort(SegmentedArray<T>& array, const Compare& comparator, unsigned int threadCount);
+
+	// sorts with the given mode, the other overloads use SortMode::radix
+	// the keyed modes fall back to SortMode::inPlace when the comparator can't give every item a key
+	template <typename Compare>
+	static void sort(ResizableArray<T>& array, const Compare& comparator, unsigned int threadCount, SortMode mode);
+	template <typename Compare>
+	static void sort(SegmentedArray<T>& array, const Compare& comparator, unsigned int threadCount, SortMode mode);
+
+	// replaces the contents of order with the position of every item in sorted order, the array itself is
+	// not changed, equal items keep the order of their positions
+	template <typename Compare>
+	static void sortedOrder(const ResizableArray<T>& array, const Compare& comparator, unsigned int threadCount, ResizableArray<unsigned long>& order);
+	template <typename Compare>
+	static void sortedOrder(const SegmentedArray<T>& array, const Compare& comparator, unsigned int threadCount, ResizableArray<unsigned long>& order);
 };
 
 // implementation goes here
@@ -26,93 +127,530 @@ callable sort method to initiate the sorting
 */
 template <typename T>
 void Sorter<T>::sort(ResizableArray<T>& array, const Comparator<T>& comparator) {
+	sortArray(array, comparator, 1, SortMode::radix);
+}
 
-	//varaible for the left and right ends of the array
-	unsigned long left = 0;
-	unsigned long right = array.getSize() - 1;
+/*
+callable sort method to initiate the sorting of a segmented array
+*/
+template <typename T>
+void Sorter<T>::sort(SegmentedArray<T>& array, const Comparator<T>& comparator) {
+	sortArray(array, comparator, 1, SortMode::radix);
+}
 
-	//calls quicksort method
-	quickSort(array, left, right, comparator);
+/*
+callable sort method to sort on several threads
+*/
+template <typename T>
+void Sorter<T>::sort(ResizableArray<T>& array, const Comparator<T>& comparator, unsigned int threadCount) {
+	sortArray(array, comparator, threadCount, SortMode::radix);
 }
 
 /*
-Quicksort method to sort the array based on the given column
-The format of this searching algorithm comes from the one in Zybooks, I modified it to fit this program
-however many of the variables and comments remain unchanged
+callable sort method to sort a segmented array on several threads
 */
-template<typename T>
-void Sorter<T>::quickSort(ResizableArray<T>& array, unsigned long left, unsigned long right, const Comparator<T>& comparator) {
-	unsigned long j = 0;
+template <typename T>
+void Sorter<T>::sort(SegmentedArray<T>& array, const Comparator<T>& comparator, unsigned int threadCount) {
+	sortArray(array, comparator, threadCount, SortMode::radix);
+}
+
+/*
+callable sort methods for a comparator type known at compile time
+*/
+template <typename T>
+template <typename Compare>
+void Sorter<T>::sort(ResizableArray<T>& array, const Compare& comparator) {
+	sortArray(array, comparator, 1, SortMode::radix);
+}
+
+template <typename T>
+template <typename Compare>
+void Sorter<T>::sort(SegmentedArray<T>& array, const Compare& comparator) {
+	sortArray(array, comparator, 1, SortMode::radix);
+}
+
+template <typename T>
+template <typename Compare>
+void Sorter<T>::sort(ResizableArray<T>& array, const Compare& comparator, unsigned int threadCount) {
+	sortArray(array, comparator, threadCount, SortMode::radix);
+}
+
+template <typename T>
+template <typename Compare>
+void Sorter<T>::sort(SegmentedArray<T>& array, const Compare& comparator, unsigned int threadCount) {
+	sortArray(array, comparator, threadCount, SortMode::radix);
+}
+
+/*
+callable sort methods that pick the sort mode
+*/
+template <typename T>
+template <typename Compare>
+void Sorter<T>::sort(ResizableArray<T>& array, const Compare& comparator, unsigned int threadCount, SortMode mode) {
+	sortArray(array, comparator, threadCount, mode);
+}
+
+template <typename T>
+template <typename Compare>
+void Sorter<T>::sort(SegmentedArray<T>& array, const Compare& comparator, unsigned int threadCount, SortMode mode) {
+	sortArray(array, comparator, threadCount, mode);
+}
+
+/*
+callable methods to get the sorted order of an array without sorting it
+*/
+template <typename T>
+template <typename Compare>
+void Sorter<T>::sortedOrder(const ResizableArray<T>& array, const Compare& comparator, unsigned int threadCount, ResizableArray<unsigned long>& order) {
+	orderArray(array, comparator, threadCount, order);
+}
+
+template <typename T>
+template <typename Compare>
+void Sorter<T>::sortedOrder(const SegmentedArray<T>& array, const Compare& comparator, unsigned int threadCount, ResizableArray<unsigned long>& order) {
+	orderArray(array, comparator, threadCount, order);
+}
 
-	// Base case: If there are 1 or zero elements to sort,
-	// partition is already sorted
-	if (left >= right) {
+/*
+Method to sort any array with getSize and getUnchecked
+*/
+template <typename T>
+template <typename Array, typename Compare>
+void Sorter<T>::sortArray(Array& array, const Compare& comparator, unsigned int threadCount, SortMode mode) {
+
+	//an empty or single item array is already sorted
+	unsigned long size = array.getSize();
+	if (size < 2) {
 		return;
 	}
 
-	// Partition the data within the array. Value j returned
-	// from partitioning is location of last element in low partition.
-	j = partition(array, left, right, comparator);
+	//quicksort may split badly at most twice log2(size) times before heapsort takes over
+	unsigned int depthLimit = 0;
+	for (unsigned long remaining = size; remaining > 1; remaining /= 2) {
+		depthLimit += 2;
+	}
+
+	//0 threads means one per hardware thread
+	if (threadCount == 0) {
+		threadCount = std::thread::hardware_concurrency();
+	}
 
-	// Recursively sort low partition (i to j) and
-	// high partition (j + 1 to k)
-	quickSort(array, left, j, comparator);
-	quickSort(array, j + 1, right, comparator);
+	//sorts keys instead of items when the comparator can give every item one
+	if (mode != SortMode::inPlace && size >= KEYED_SORT_ITEMS && keyedSort(array, comparator, threadCount, mode)) {
+		return;
+	}
+
+	if (threadCount > 1) {
+		parallelIntroSort(array, 0, size, depthLimit, threadCount, comparator);
+	}
+	else {
+		introSort(array, 0, size, depthLimit, comparator);
+	}
 }
 
 /*
-Partitioning file to split the array when sorting
-Taken and modified from the method given in zybooks
+Introsort method to sort the items in [first, last)
+Quicksorts the range, looping on the larger part and recursing on the smaller one so the stack
+stays O(log n) deep, switches to heapsort once the depth limit is used up and leaves small
+ranges to insertion sort
 */
 template <typename T>
-unsigned long Sorter<T>::partition(ResizableArray<T>& array, unsigned long left, unsigned long right, const Comparator<T>& comparator) {
+template <typename Array, typename Compare>
+void Sorter<T>::introSort(Array& array, unsigned long first, unsigned long last, unsigned int depthLimit, const Compare& comparator) {
+
+	while (last - first > INSERTION_SORT_ITEMS) {
 
-	//declare variables
-	unsigned long l = 0;
-	unsigned long h = 0;
-	unsigned long midpoint = 0;
-	T pivot;
-	T temp;
-	bool done = false;
+		//too many bad splits, heapsort is O(n log n) whatever the data looks like
+		if (depthLimit == 0) {
+			heapSort(array, first, last, comparator);
+			return;
+		}
+		depthLimit--;
 
-	// Pick middle element as pivot
-	midpoint = left + (right - left) / 2;
-	pivot = array.get(midpoint);
+		//splits the range around a pivot that ends up at cut
+		choosePivot(array, first, last, comparator);
+		unsigned long cut = partition(array, first, last, comparator);
 
-	l = left;
-	h = right;
+		//recurses on the smaller part and keeps looping on the larger one
+		if (cut - first < last - cut) {
+			introSort(array, first, cut, depthLimit, comparator);
+			first = cut + 1;
+		}
+		else {
+			introSort(array, cut + 1, last, depthLimit, comparator);
+			last = cut;
+		}
+	}
 
-	//while loop to partition the array
-	while (!done) {
+	insertionSort(array, first, last, comparator);
+}
 
-		// Increment l while numbers[l] < pivot
-		while (l < array.getSize() && (comparator.compare(array.get(l), pivot) < 0)) {
-			++l;
+/*
+Introsort method that shares [first, last) between threadCount threads
+Each level partitions exactly as introSort would, then sorts the lower part on a new thread
+and the upper part on this one. The parts never overlap and each is sorted by the same steps
+the serial sort would take, so the result doesn't depend on the thread count or on timing
+*/
+template <typename T>
+template <typename Array, typename Compare>
+void Sorter<T>::parallelIntroSort(Array& array, unsigned long first, unsigned long last, unsigned int depthLimit, unsigned int threadCount, const Compare& comparator) {
+
+	//finishes on this thread once there is no thread to share with or too little work to share
+	if (threadCount < 2 || last - first < PARALLEL_SORT_ITEMS || depthLimit == 0) {
+		introSort(array, first, last, depthLimit, comparator);
+		return;
+	}
+	depthLimit--;
+
+	//splits the range around a pivot that ends up at cut
+	choosePivot(array, first, last, comparator);
+	unsigned long cut = partition(array, first, last, comparator);
+
+	//gives half of the threads to each part
+	unsigned int lowerThreads = threadCount / 2;
+	std::thread lower([&array, first, cut, depthLimit, lowerThreads, &comparator]() {
+		parallelIntroSort(array, first, cut, depthLimit, lowerThreads, comparator);
+	});
+	parallelIntroSort(array, cut + 1, last, depthLimit, threadCount - lowerThreads, comparator);
+	lower.join();
+}
+
+/*
+Method to sort through (key, index) pairs, returns false without changing the array if the
+comparator can't give every item a key
+The pairs are a small fraction of the size of a record, so sorting them moves far less memory
+than sorting the items, which are then each moved once into place
+*/
+template <typename T>
+template <typename Array, typename Compare>
+bool Sorter<T>::keyedSort(Array& array, const Compare& comparator, unsigned int threadCount, SortMode mode) {
+	ResizableArray<SortKey> keys;
+	if (!getKeys(array, comparator, keys)) {
+		return false;
+	}
+
+	//ties are broken by index in both modes, so they give the same stable order
+	if (mode == SortMode::radix) {
+		radixSortKeys(keys);
+	}
+	else {
+		Sorter<SortKey>::sortArray(keys, SortKeyOrder(), threadCount, SortMode::inPlace);
+	}
+
+	applyOrder(array, keys);
+	return true;
+}
+
+/*
+Method to find the order of the items without moving them
+Sorts (key, index) pairs when the comparator gives every item a key, otherwise sorts the positions
+by comparing the items they point at
+*/
+template <typename T>
+template <typename Array, typename Compare>
+void Sorter<T>::orderArray(const Array& array, const Compare& comparator, unsigned int threadCount, ResizableArray<unsigned long>& order) {
+	unsigned long size = array.getSize();
+	order.clear();
+	order.reserve(size);
+
+	//0 threads means one per hardware thread
+	if (threadCount == 0) {
+		threadCount = std::thread::hardware_concurrency();
+	}
+
+	ResizableArray<SortKey> keys;
+	if (size >= KEYED_SORT_ITEMS && getKeys(array, comparator, keys)) {
+		radixSortKeys(keys);
+		for (unsigned long i = 0; i < size; i++) {
+			order.add(keys.getUnchecked(i).index);
 		}
+		return;
+	}
 
-		// Decrement h while pivot < numbers[h]
-		while (h < array.getSize() && (comparator.compare(array.get(h), pivot) > 0)) {
-			--h;
+	for (unsigned long i = 0; i < size; i++) {
+		order.add(i);
+	}
+	IndexOrder<Array, Compare> indexOrder = { array, comparator };
+	Sorter<unsigned long>::sortArray(order, indexOrder, threadCount, SortMode::inPlace);
+}
+
+/*
+Method to compare the items at two positions, ties go to the lower position so the order is stable
+*/
+template <typename T>
+template <typename Array, typename Compare>
+int Sorter<T>::IndexOrder<Array, Compare>::compare(unsigned long index1, unsigned long index2) const {
+	int comparison = comparator.compare(array.getUnchecked(index1), array.getUnchecked(index2));
+	if (comparison != 0) {
+		return comparison;
+	}
+	return (index1 < index2) ? -1 : ((index1 > index2) ? 1 : 0);
+}
+
+/*
+Method to get the key of every item through the comparator, returns false if the comparator
+can't give every item a key
+*/
+template <typename T>
+template <typename Array, typename Compare>
+bool Sorter<T>::getKeys(const Array& array, const Compare& comparator, ResizableArray<SortKey>& keys) {
+
+	//the key is fetched without virtual dispatch when the comparator type already says it is a SortKeyExtractor
+	if constexpr (std::is_base_of<SortKeyExtractor<T>, Compare>::value) {
+		return extractKeys(array, comparator, keys);
+	}
+	else if constexpr (std::is_polymorphic<Compare>::value) {
+		const SortKeyExtractor<T>* extractor = dynamic_cast<const SortKeyExtractor<T>*>(&comparator);
+		return (extractor != nullptr) && extractKeys(array, *extractor, keys);
+	}
+	else {
+		return false;
+	}
+}
+
+/*
+Method to get the key of every item, returns false as soon as an item has none
+*/
+template <typename T>
+template <typename Array, typename Extractor>
+bool Sorter<T>::extractKeys(const Array& array, const Extractor& extractor, ResizableArray<SortKey>& keys) {
+	unsigned long size = array.getSize();
+	keys.reserve(size);
+
+	for (unsigned long i = 0; i < size; i++) {
+		SortKey key;
+		if (!extractor.getSortKey(array.getUnchecked(i), key.key)) {
+			return false;
 		}
+		key.index = i;
+		keys.add(key);
+	}
+	return true;
+}
 
-		// If there are zero or one elements remaining,
-		// all numbers are partitioned. Return h
-		if (l >= h) {
-			done = true;
+/*
+LSD radix sort method for sort keys
+Does one stable counting pass per byte of the key, lowest byte first, and skips bytes every key shares
+*/
+template <typename T>
+void Sorter<T>::radixSortKeys(ResizableArray<SortKey>& keys) {
+	unsigned long size = keys.getSize();
+	SortKey* items = keys.begin();
+	std::vector<SortKey> buffer(size);
+	SortKey* other = buffer.data();
+
+	//counts how often each byte value appears at each of the 8 byte positions
+	std::vector<unsigned long> counts(8 * 256, 0);
+	for (unsigned long i = 0; i < size; i++) {
+		for (unsigned int b = 0; b < 8; b++) {
+			counts[b * 256 + ((items[i].key >> (8 * b)) & 0xFF)]++;
 		}
-		else {
-			// Swap numbers[l] and numbers[h],
-			// update l and h
-			temp = array.get(l);
-			array.replaceAt(array.get(h), l);
-			array.replaceAt(temp, h);
+	}
+
+	for (unsigned int b = 0; b < 8; b++) {
+		unsigned long* count = &counts[b * 256];
+
+		//a byte every key shares doesn't change the order
+		if (count[(items[0].key >> (8 * b)) & 0xFF] == size) {
+			continue;
+		}
+
+		//turns the counts into the first position of each byte value
+		unsigned long position = 0;
+		for (unsigned int value = 0; value < 256; value++) {
+			unsigned long valueCount = count[value];
+			count[value] = position;
+			position += valueCount;
+		}
+
+		for (unsigned long i = 0; i < size; i++) {
+			other[count[(items[i].key >> (8 * b)) & 0xFF]++] = items[i];
+		}
+		std::swap(items, other);
+	}
+
+	//an odd number of passes leaves the result in the buffer
+	if (items != keys.begin()) {
+		std::copy(items, items + size, keys.begin());
+	}
+}
+
+/*
+Method to rearrange the array so position i holds the item that was at keys[i].index
+Follows each cycle of the permutation so every item is moved once, the indexes are used up as it goes
+*/
+template <typename T>
+template <typename Array>
+void Sorter<T>::applyOrder(Array& array, ResizableArray<SortKey>& keys) {
+	for (unsigned long start = 0; start < keys.getSize(); start++) {
 
+		//skips items already in place, including cycles that were finished earlier
+		if (keys.getUnchecked(start).index == start) {
+			continue;
+		}
+
+		//lifts the first item out and pulls each item of the cycle into the gap before it
+		T item = std::move(array.getUnchecked(start));
+		unsigned long gap = start;
+		while (keys.getUnchecked(gap).index != start) {
+			unsigned long next = keys.getUnchecked(gap).index;
+			array.getUnchecked(gap) = std::move(array.getUnchecked(next));
+			keys.getUnchecked(gap).index = gap;
+			gap = next;
+		}
+		array.getUnchecked(gap) = std::move(item);
+		keys.getUnchecked(gap).index = gap;
+	}
+}
+
+/*
+Method to put the items at three positions in order
+*/
+template <typename T>
+template <typename Array, typename Compare>
+void Sorter<T>::sortThree(Array& array, unsigned long a, unsigned long b, unsigned long c, const Compare& comparator) {
+	if (comparator.compare(array.getUnchecked(b), array.getUnchecked(a)) < 0) {
+		std::swap(array.getUnchecked(a), array.getUnchecked(b));
+	}
+	if (comparator.compare(array.getUnchecked(c), array.getUnchecked(b)) < 0) {
+		std::swap(array.getUnchecked(b), array.getUnchecked(c));
+		if (comparator.compare(array.getUnchecked(b), array.getUnchecked(a)) < 0) {
+			std::swap(array.getUnchecked(a), array.getUnchecked(b));
+		}
+	}
+}
+
+/*
+Method to move a good pivot to the front of [first, last)
+Uses the median of the first, middle and last items, or for large ranges the median of
+three such medians (Tukey's ninther), so sorted and reversed columns still split evenly
+*/
+template <typename T>
+template <typename Array, typename Compare>
+void Sorter<T>::choosePivot(Array& array, unsigned long first, unsigned long last, const Compare& comparator) {
+	unsigned long count = last - first;
+	unsigned long mid = first + count / 2;
+
+	if (count >= NINTHER_ITEMS) {
+		sortThree(array, first, mid, last - 1, comparator);
+		sortThree(array, first + 1, mid - 1, last - 2, comparator);
+		sortThree(array, first + 2, mid + 1, last - 3, comparator);
+		sortThree(array, mid - 1, mid, mid + 1, comparator);
+	}
+	else {
+		sortThree(array, first, mid, last - 1, comparator);
+	}
+	std::swap(array.getUnchecked(first), array.getUnchecked(mid));
+}
+
+/*
+Partitioning method to split [first, last) around the pivot at first
+Both scans stop on items equal to the pivot, so a column full of one value still splits
+down the middle. Returns where the pivot ends up, everything before it is no greater and
+everything after it is no smaller
+*/
+template <typename T>
+template <typename Array, typename Compare>
+unsigned long Sorter<T>::partition(Array& array, unsigned long first, unsigned long last, const Compare& comparator) {
+
+	//the pivot stays at first until the scans meet, so it can be compared in place
+	const T& pivot = array.getUnchecked(first);
+	unsigned long l = first + 1;
+	unsigned long h = last - 1;
+
+	while (true) {
+
+		//moves l past items smaller than the pivot
+		while (l <= h && comparator.compare(array.getUnchecked(l), pivot) < 0) {
 			++l;
+		}
+
+		//moves h past items larger than the pivot, the pivot itself stops it at first
+		while (comparator.compare(array.getUnchecked(h), pivot) > 0) {
 			--h;
 		}
+
+		if (l >= h) {
+			break;
+		}
+
+		//both items are on the wrong side, swaps them and keeps going
+		std::swap(array.getUnchecked(l), array.getUnchecked(h));
+		++l;
+		--h;
 	}
 
+	//puts the pivot between the two parts
+	std::swap(array.getUnchecked(first), array.getUnchecked(h));
 	return h;
 }
 
-#endif
\ No newline at end of file
+/*
+Insertion sort method for the items in [first, last), fast on the small ranges introsort leaves behind
+*/
+template <typename T>
+template <typename Array, typename Compare>
+void Sorter<T>::insertionSort(Array& array, unsigned long first, unsigned long last, const Compare& comparator) {
+	for (unsigned long i = first + 1; i < last; i++) {
+
+		//skips items that are already in place
+		if (comparator.compare(array.getUnchecked(i), array.getUnchecked(i - 1)) >= 0) {
+			continue;
+		}
+
+		//shifts larger items right until the gap is where the item belongs
+		T item = std::move(array.getUnchecked(i));
+		unsigned long j = i;
+		while (j > first && comparator.compare(item, array.getUnchecked(j - 1)) < 0) {
+			array.getUnchecked(j) = std::move(array.getUnchecked(j - 1));
+			j--;
+		}
+		array.getUnchecked(j) = std::move(item);
+	}
+}
+
+/*
+Method to move the item at root down a max heap of count items starting at first
+*/
+template <typename T>
+template <typename Array, typename Compare>
+void Sorter<T>::siftDown(Array& array, unsigned long first, unsigned long root, unsigned long count, const Compare& comparator) {
+	T item = std::move(array.getUnchecked(first + root));
+
+	//keeps moving the larger child up until the item is larger than both children
+	unsigned long child = 2 * root + 1;
+	while (child < count) {
+		if (child + 1 < count && comparator.compare(array.getUnchecked(first + child), array.getUnchecked(first + child + 1)) < 0) {
+			child++;
+		}
+		if (comparator.compare(item, array.getUnchecked(first + child)) >= 0) {
+			break;
+		}
+		array.getUnchecked(first + root) = std::move(array.getUnchecked(first + child));
+		root = child;
+		child = 2 * root + 1;
+	}
+	array.getUnchecked(first + root) = std::move(item);
+}
+
+/*
+Heapsort method for the items in [first, last), used when quicksort keeps splitting badly
+*/
+template <typename T>
+template <typename Array, typename Compare>
+void Sorter<T>::heapSort(Array& array, unsigned long first, unsigned long last, const Compare& comparator) {
+	unsigned long count = last - first;
+
+	//builds a max heap out of the range
+	for (unsigned long root = count / 2; root > 0; root--) {
+		siftDown(array, first, root - 1, count, comparator);
+	}
+
+	//repeatedly moves the largest item to the end and restores the heap on the rest
+	for (unsigned long end = count - 1; end > 0; end--) {
+		std::swap(array.getUnchecked(first), array.getUnchecked(first + end));
+		siftDown(array, first, 0, end, comparator);
+	}
+}
+
+#endif
@@ -0,0 +1,129 @@
+#include "TimeStampHasher.h"
+
+#include <cstring>
+#include <string>
+
+using namespace std;
+
+//multipliers from xxHash64, odd 64 bit constants with well spread bits
+const unsigned long long PRIME_1 = 0x9E3779B185EBCA87ULL;
+const unsigned long long PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+const unsigned long long PRIME_3 = 0x165667B19E3779F9ULL;
+const unsigned long long PRIME_4 = 0x85EBCA77C2B2AE63ULL;
+const unsigned long long PRIME_5 = 0x27D4EB2F165667C5ULL;
+
+/*
+Function to rotate the bits of a value left
+*/
+static inline unsigned long long rotateLeft(unsigned long long value, unsigned int bits) {
+	return (value << bits) | (value >> (64 - bits));
+}
+
+/*
+Function to fold a 64 bit hash into an unsigned long, which is 32 bits on Windows, without losing the high bits
+*/
+static inline unsigned long fold(unsigned long long value) {
+	return (unsigned long)(value ^ (value >> 32));
+}
+
+/*
+Function to add up the character codes of a time stamp
+*/
+static unsigned long hashAsciiSum(string_view timeStamp) {
+	unsigned long total = 0;
+	for (unsigned long i = 0; i < timeStamp.size(); i++) {
+		total += (unsigned long)(int)timeStamp[i];
+	}
+	return total;
+}
+
+/*
+Function to hash the characters of a time stamp 8 at a time and then one at a time, then mix every
+bit into every other with the xxHash64 avalanche
+*/
+static unsigned long hashBytes(string_view timeStamp) {
+	unsigned long long hash = PRIME_5 + timeStamp.size();
+	unsigned long i = 0;
+
+	for (; i + 8 <= timeStamp.size(); i += 8) {
+		unsigned long long block;
+		memcpy(&block, timeStamp.data() + i, sizeof(block));
+		hash ^= rotateLeft(block * PRIME_2, 31) * PRIME_1;
+		hash = rotateLeft(hash, 27) * PRIME_1 + PRIME_4;
+	}
+	for (; i < timeStamp.size(); i++) {
+		hash ^= (unsigned char)timeStamp[i] * PRIME_5;
+		hash = rotateLeft(hash, 11) * PRIME_1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= PRIME_2;
+	hash ^= hash >> 29;
+	hash *= PRIME_3;
+	hash ^= hash >> 32;
+	return fold(hash);
+}
+
+/*
+Function to hash a time stamp by its seconds since midnight, every time stamp in a day gets a different
+number before the mix, the splitmix64 finalizer then spreads consecutive seconds over the whole range
+*/
+static unsigned long hashSeconds(string_view timeStamp) {
+
+	//anything that isn't HH:MM:SS is hashed by its characters
+	if (timeStamp.size() != 8 || timeStamp[2] != ':' || timeStamp[5] != ':') {
+		return hashBytes(timeStamp);
+	}
+	unsigned long long seconds = 0;
+	for (unsigned int i = 0; i < 8; i++) {
+		if (i == 2 || i == 5) {
+			continue;
+		}
+		if (timeStamp[i] < '0' || timeStamp[i] > '9') {
+			return hashBytes(timeStamp);
+		}
+		seconds = seconds * 10 + (unsigned long long)(timeStamp[i] - '0');
+	}
+
+	//the digits are read as HHMMSS, which is just as distinct as seconds since midnight
+	unsigned long long hash = seconds + PRIME_1;
+	hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+	hash ^= hash >> 31;
+	return fold(hash);
+}
+
+/*
+Constructor, sets the hash function to use
+*/
+TimeStampHasher::TimeStampHasher(TimeHashFunction function) {
+	this->function = function;
+}
+
+/*
+Method to hash a record by its time stamp
+*/
+unsigned long TimeStampHasher::hash(const DrillingRecord& item) const {
+	return hashTimeStamp(item.getString(1), function);
+}
+
+/*
+Method to hash a time stamp on its own, the same value hash gives a record with that time stamp
+*/
+unsigned long TimeStampHasher::hashKey(const string_view& timeStamp) const {
+	return hashTimeStamp(timeStamp, function);
+}
+
+/*
+Method to hash a time stamp with the given function
+*/
+unsigned long TimeStampHasher::hashTimeStamp(string_view timeStamp, TimeHashFunction function) {
+	switch (function) {
+	case TimeHashFunction::bytes:
+		return hashBytes(timeStamp);
+	case TimeHashFunction::seconds:
+		return hashSeconds(timeStamp);
+	default:
+		return hashAsciiSum(timeStamp);
+	}
+}
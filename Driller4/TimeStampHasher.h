@@ -0,0 +1,37 @@
+#pragma once
+#ifndef TIME_STAMP_HASHER_H
+#define TIME_STAMP_HASHER_H
+
+#include <string_view>
+#include "Hasher.h"
+#include "KeyHasher.h"
+#include "DrillingRecord.h"
+
+// the hash functions a TimeStampHasher can apply to a record's time stamp
+enum class TimeHashFunction {
+	asciiSum,                                          // sum of the character codes, the same as DrillingRecordHasher
+	bytes,                                             // xxHash64 style multiply and rotate mix of the characters
+	seconds                                            // HH:MM:SS as seconds since midnight through a 64 bit integer mix
+};
+
+// hashes records by time stamp with a function chosen when the hasher is made, so a HashTable picks its
+// hash function by the hasher it is constructed with
+// the sum of the character codes only takes about 50 values over a day of time stamps and gives the same
+// value to permutations like 10:07:58 and 10:08:57, the other functions spread every time stamp over the
+// whole range of the hash
+// as a KeyHasher it also hashes a bare time stamp, so HashTable::findKey needs no record to look one up
+class TimeStampHasher : public Hasher<DrillingRecord>, public KeyHasher<std::string_view> {
+private:
+	TimeHashFunction function;                         // the function applied to each time stamp
+public:
+	TimeStampHasher(TimeHashFunction function);        // creates a hasher that uses function
+
+	unsigned long hash(const DrillingRecord& item) const;
+	unsigned long hashKey(const std::string_view& timeStamp) const;
+
+	// the hash of a time stamp on its own, the same value hash gives a record with that time stamp
+	// time stamps that are not HH:MM:SS are hashed as bytes by the seconds function
+	static unsigned long hashTimeStamp(std::string_view timeStamp, TimeHashFunction function);
+};
+
+#endif // !TIME_STAMP_HASHER_H
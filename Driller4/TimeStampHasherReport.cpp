@@ -0,0 +1,123 @@
+// TimeStampHasherReport.cpp : reports how evenly each TimeStampHasher function spreads time stamps over the
+// buckets of HashTable and OpenHashTable, this file has its own 'main' so it is not part of the Driller4 project
+//
+// build it from this folder with the tables' sources, e.g.
+//     g++ -std=c++17 -O2 TimeStampHasherReport.cpp ResizePolicy.cpp TimeStampHasher.cpp DrillingRecord.cpp
+//         DrillingRecordComparator.cpp DrillingRecordKeyComparator.cpp
+//
+// usage: TimeStampHasherReport [records] [first second]
+// with no arguments it reports a full day of time stamps and the 8000 from 10:00:00, with arguments it reports
+// records time stamps starting at first second, which defaults to midnight
+// each table is sized for its records as mainHashTable is, the longest probe is only kept by the open table
+// the asciiSum rows take most of the run time with a full day, since its few dozen chains are thousands long
+
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+#include <cstdio>
+#include <vector>
+#include "DrillingRecord.h"
+#include "DrillingRecordKeyComparator.h"
+#include "TimeStampHasher.h"
+#include "HashTable.h"
+#include "OpenHashTable.h"
+
+using namespace std;
+
+//seconds in a day, the most distinct time stamps one file can hold
+const unsigned long DAY_SECONDS = 86400;
+
+//the second of the day the smaller default report starts at and how many time stamps it holds
+const unsigned long SAMPLE_FIRST_SECOND = 10 * 3600;
+const unsigned long SAMPLE_RECORDS = 8000;
+
+
+/*============================================================================================
+Function to create a record for each of count seconds from firstSecond, wrapping past midnight
+*/
+vector<DrillingRecord> createRecords(unsigned long count, unsigned long firstSecond) {
+	vector<DrillingRecord> records(count);
+	for (unsigned long i = 0; i < count; i++) {
+		unsigned long second = (firstSecond + i) % DAY_SECONDS;
+		char timeStamp[16];
+		snprintf(timeStamp, sizeof(timeStamp), "%02lu:%02lu:%02lu", second / 3600, (second / 60) % 60, second % 60);
+		records[i].setString("7/31/2017", 0);
+		records[i].setString(timeStamp, 1);
+		records[i].setNum((double)second, 0);
+	}
+	return records;
+}
+//============================================================================================
+
+
+/*============================================================================================
+Function to print one row of the report, the buckets used, longest chain, mean and variance of one
+table of every record under one hash function
+*/
+void printStatistics(const string& hasherName, const string& tableName, unsigned long baseCapacity,
+	const HashTableStatistics& statistics, const string& longestProbe) {
+
+	cout << left << setw(10) << hasherName << setw(9) << tableName << right
+		<< setw(10) << baseCapacity
+		<< setw(10) << statistics.usedBuckets
+		<< setw(9) << statistics.longestChain
+		<< setw(9) << fixed << setprecision(2) << statistics.meanChain
+		<< setw(11) << statistics.chainVariance
+		<< setw(9) << longestProbe << endl;
+}
+//============================================================================================
+
+
+/*============================================================================================
+Function to report every hash function on both tables for one set of records
+*/
+void reportRecords(const vector<DrillingRecord>& records) {
+	cout << records.size() << " time stamps from " << records[0].getString(1) << endl;
+	cout << "hasher    table     buckets      used  longest     mean   variance    probe" << endl;
+
+	const TimeHashFunction functions[] = { TimeHashFunction::asciiSum, TimeHashFunction::bytes, TimeHashFunction::seconds };
+	const string functionNames[] = { "asciiSum", "bytes", "seconds" };
+	for (unsigned int f = 0; f < 3; f++) {
+		DrillingRecordKeyComparator comparator(1);
+		TimeStampHasher hasher(functions[f]);
+
+		//the chained table
+		HashTable<DrillingRecord> chained(&comparator, &hasher, (unsigned long)records.size());
+		for (unsigned long i = 0; i < records.size(); i++) {
+			chained.insert(records[i]);
+		}
+		printStatistics(functionNames[f], "chained", chained.getBaseCapacity(), chained.getStatistics(), "-");
+
+		//the open table, where each item counts against its home slot
+		OpenHashTable<DrillingRecord> open(&comparator, &hasher, (unsigned long)records.size());
+		for (unsigned long i = 0; i < records.size(); i++) {
+			open.insert(records[i]);
+		}
+		printStatistics(functionNames[f], "open", open.getBaseCapacity(), open.getStatistics(), to_string(open.getMaxProbeLength()));
+	}
+	cout << endl;
+}
+//============================================================================================
+
+
+int main(int argc, char* argv[]) {
+
+	//reports the records asked for
+	if (argc > 1) {
+		unsigned long count = strtoul(argv[1], nullptr, 10);
+		unsigned long firstSecond = (argc > 2) ? strtoul(argv[2], nullptr, 10) : 0;
+		if (count == 0 || count > DAY_SECONDS) {
+			cout << "usage: TimeStampHasherReport [records] [first second], records is 1 to " << DAY_SECONDS << endl;
+			return 1;
+		}
+		reportRecords(createRecords(count, firstSecond));
+		return 0;
+	}
+
+	//reports a full day and a smaller sample like a single data file
+	reportRecords(createRecords(DAY_SECONDS, 0));
+	reportRecords(createRecords(SAMPLE_RECORDS, SAMPLE_FIRST_SECOND));
+	return 0;
+}
@@ -0,0 +1,110 @@
+#include "TimeStampIndex.h"
+
+using namespace std;
+
+/*
+Constructor, creates an index with the default number of empty slots
+*/
+TimeStampIndex::TimeStampIndex() {
+	slots.assign(DEFAULT_INDEX_SLOTS, -1);
+}
+
+/*
+Method to hash a time stamp, FNV-1a spreads the few characters that differ between stamps over the whole value
+*/
+unsigned long TimeStampIndex::hash(string_view timeStamp) {
+
+	unsigned long long value = 14695981039346656037ULL;
+	for (unsigned long i = 0; i < timeStamp.size(); i++) {
+		value ^= (unsigned char)timeStamp[i];
+		value *= 1099511628211ULL;
+	}
+	return (unsigned long)(value ^ (value >> 32));
+}
+
+/*
+Method to find the slot holding a time stamp, or the empty slot where it would go
+*/
+long TimeStampIndex::findSlot(string_view timeStamp, unsigned long timeHash) const {
+
+	unsigned long mask = (unsigned long)slots.size() - 1;
+	unsigned long slot = timeHash & mask;
+
+	//probes forward until the stamp or an empty slot is found, the table is never full
+	while (slots[slot] != -1) {
+		long position = slots[slot];
+		if (hashes[position] == timeHash && keys[position] == timeStamp) {
+			return (long)slot;
+		}
+		slot = (slot + 1) & mask;
+	}
+	return (long)slot;
+}
+
+/*
+Method to double the number of slots and re-place every key
+*/
+void TimeStampIndex::grow() {
+
+	slots.assign(slots.size() * 2, -1);
+	unsigned long mask = (unsigned long)slots.size() - 1;
+
+	//keys are all distinct so each one only needs the next empty slot
+	for (unsigned long i = 0; i < keys.size(); i++) {
+		unsigned long slot = hashes[i] & mask;
+		while (slots[slot] != -1) {
+			slot = (slot + 1) & mask;
+		}
+		slots[slot] = (long)i;
+	}
+}
+
+/*
+Method to check if the index contains a time stamp
+*/
+bool TimeStampIndex::contains(string_view timeStamp) const {
+	return slots[findSlot(timeStamp, hash(timeStamp))] != -1;
+}
+
+/*
+Method to add a time stamp to the index if it isn't already there
+*/
+bool TimeStampIndex::insert(string_view timeStamp) {
+
+	unsigned long timeHash = hash(timeStamp);
+	long slot = findSlot(timeStamp, timeHash);
+
+	//returns false if the stamp is already present
+	if (slots[slot] != -1) {
+		return false;
+	}
+
+	//adds the stamp, growing first if that would make the table more than half full
+	if ((keys.size() + 1) * 2 > slots.size()) {
+		keys.emplace_back(timeStamp);
+		hashes.push_back(timeHash);
+		grow();
+	}
+	else {
+		slots[slot] = (long)keys.size();
+		keys.emplace_back(timeStamp);
+		hashes.push_back(timeHash);
+	}
+	return true;
+}
+
+/*
+Method to return the number of time stamps in the index
+*/
+unsigned long TimeStampIndex::getSize() const {
+	return (unsigned long)keys.size();
+}
+
+/*
+Method to remove every time stamp, the index goes back to the default number of slots
+*/
+void TimeStampIndex::clear() {
+	keys.clear();
+	hashes.clear();
+	slots.assign(DEFAULT_INDEX_SLOTS, -1);
+}
@@ -0,0 +1,37 @@
+#pragma once
+#ifndef TIME_STAMP_INDEX_H
+#define TIME_STAMP_INDEX_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+const unsigned long DEFAULT_INDEX_SLOTS = 1024;               // slots in a new index, always a power of two
+
+// TimeStampIndex is a set of time stamps used to find duplicates while a file is read in
+// it uses open addressing with linear probing over positions in a key array, so a lookup is a
+// single hash and a short probe, and looking up a string_view never allocates anything
+class TimeStampIndex {
+private:
+	std::vector<std::string> keys;                             // each distinct time stamp, in insertion order
+	std::vector<unsigned long> hashes;                         // hash of each key, so growing doesn't rehash strings
+	std::vector<long> slots;                                   // position in keys for each slot, -1 if the slot is empty
+	long findSlot(std::string_view timeStamp, unsigned long timeHash) const;  // slot holding timeStamp or the empty slot where it belongs
+	void grow();                                               // doubles the slots and re-places every key
+public:
+	TimeStampIndex();                                          // creates an empty index
+
+	static unsigned long hash(std::string_view timeStamp);     // FNV-1a hash of the time stamp, also used by ConcurrentTimeStampIndex
+
+	// if timeStamp is present return true, otherwise return false
+	bool contains(std::string_view timeStamp) const;
+
+	// if timeStamp is not already present, add it and return true
+	// if timeStamp is already present, leave index unchanged and return false
+	bool insert(std::string_view timeStamp);
+
+	unsigned long getSize() const;                             // returns the number of time stamps in the index
+	void clear();                                              // removes every time stamp
+};
+
+#endif // !TIME_STAMP_INDEX_H